@@ -0,0 +1,212 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Benchmark.h"
+
+#include "detail/text_format.h"
+
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+  const int values = 1000;
+
+  // The previous implementation of bind_result_t::_bind_date_time_result, kept as the reference point
+  namespace previous
+  {
+    const auto date_digits = std::vector<char>{1, 1, 1, 1, 0, 1, 1, 0, 1, 1};
+    const auto time_digits = std::vector<char>{0, 1, 1, 0, 1, 1, 0, 1, 1};
+    const auto tz_digits = std::vector<char>{0, 1, 1};
+    const auto tz_min_digits = std::vector<char>{0, 1, 1};
+
+    bool check_digits(const char* text, const std::vector<char>& digitFlags)
+    {
+      for (const auto digitFlag : digitFlags)
+      {
+        if (digitFlag ? !std::isdigit(*text) : (std::isdigit(*text) || *text == '\0'))
+        {
+          return false;
+        }
+        ++text;
+      }
+      return true;
+    }
+
+    ::sqlpp::chrono::microsecond_point parse(const char* date_string, size_t len)
+    {
+      ::sqlpp::chrono::microsecond_point value;
+      if (len >= date_digits.size() && check_digits(date_string, date_digits))
+      {
+        const auto ymd = ::date::year(std::atoi(date_string)) / std::atoi(date_string + 5) / std::atoi(date_string + 8);
+        value = ::sqlpp::chrono::day_point(ymd);
+      }
+      else
+      {
+        return {};
+      }
+
+      auto date_time_size = date_digits.size() + time_digits.size();
+      const auto time_string = date_string + date_digits.size();
+      if ((len >= date_time_size) && check_digits(date_string, date_digits))
+      {
+        value += std::chrono::hours(std::atoi(time_string + 1)) + std::chrono::minutes(std::atoi(time_string + 4)) +
+                 std::chrono::seconds(std::atoi(time_string + 7));
+      }
+      else
+      {
+        return value;
+      }
+
+      if ((len > date_time_size) && (time_string[time_digits.size()] == '.'))
+      {
+        date_time_size++;
+        const auto ms_string = time_string + time_digits.size() + 1;
+        int digits_count = 0;
+        while (ms_string[digits_count] != '\0' && ms_string[digits_count] != '-' && ms_string[digits_count] != '+')
+        {
+          if (!std::isdigit(ms_string[digits_count]))
+          {
+            return {};
+          }
+          ++digits_count;
+        }
+        if (digits_count == 0)
+        {
+          return {};
+        }
+        date_time_size += digits_count;
+        int pg_ms_num = std::atoi(ms_string);
+        while (digits_count++ < 6)
+          pg_ms_num *= 10;
+        value += std::chrono::microseconds(pg_ms_num);
+      }
+      if (len >= (date_time_size + tz_digits.size()))
+      {
+        const auto tz_string = date_string + date_time_size;
+        const auto zone_hour = std::atoi(tz_string);
+        auto zone_min = 0;
+        if ((len >= date_time_size + tz_digits.size() + tz_min_digits.size()) &&
+            check_digits(tz_string + tz_digits.size(), tz_min_digits))
+        {
+          zone_min = std::atoi(tz_string + tz_digits.size() + 1);
+        }
+        value += std::chrono::hours(zone_hour);
+        value += (zone_hour >= 0 ? 1 : -1) * std::chrono::minutes(zone_min);
+      }
+      return value;
+    }
+  }  // namespace previous
+
+  // The formats the server sends with the ISO DateStyle (see src/detail/text_format.h)
+  std::vector<std::string> make_values(const char* suffix, bool with_fraction, bool date_only)
+  {
+    std::vector<std::string> result;
+    char buffer[64];
+    for (int i = 0; i < values; ++i)
+    {
+      if (date_only)
+      {
+        std::snprintf(buffer, sizeof(buffer), "%04d-%02d-%02d", 1900 + i % 200, i % 12 + 1, i % 28 + 1);
+      }
+      else if (with_fraction)
+      {
+        std::snprintf(buffer, sizeof(buffer), "%04d-%02d-%02d %02d:%02d:%02d.%06d%s", 1900 + i % 200, i % 12 + 1,
+                      i % 28 + 1, i % 24, i % 60, (i * 7) % 60, i * 997 % 1000000, suffix);
+      }
+      else
+      {
+        std::snprintf(buffer, sizeof(buffer), "%04d-%02d-%02d %02d:%02d:%02d%s", 1900 + i % 200, i % 12 + 1,
+                      i % 28 + 1, i % 24, i % 60, (i * 7) % 60, suffix);
+      }
+      result.push_back(buffer);
+    }
+    return result;
+  }
+}
+
+int DateTimeParse(int, char*[])
+{
+  struct format
+  {
+    const char* name;
+    std::vector<std::string> values;
+  };
+  const format formats[] = {
+      {"timestamp", make_values("", false, false)},
+      {"timestamp.fraction", make_values("", true, false)},
+      {"timestamptz", make_values("-08", false, false)},
+      {"timestamptz.fraction", make_values("+02", true, false)},
+      {"timestamptz half hour offset", make_values("-06:30", false, false)},
+      {"date", make_values("", false, true)},
+  };
+
+  // 1000 values times 2000 iterations, two million parses per format and implementation
+  const std::size_t iterations = 2000;
+  for (const auto& f : formats)
+  {
+    const auto& text = f.values;
+    const double reference = bench::measure(std::string("previous ") + f.name, iterations, [&text] {
+      int64_t sum = 0;
+      for (const auto& value : text)
+      {
+        sum += previous::parse(value.c_str(), value.size()).time_since_epoch().count();
+      }
+      bench::keep(sum);
+    }) / values;
+
+    const double parsed = bench::measure(std::string("parse_iso_date_time ") + f.name, iterations, [&text] {
+      int64_t sum = 0;
+      ::sqlpp::chrono::microsecond_point value;
+      for (const auto& v : text)
+      {
+        sqlpp::postgresql::detail::parse_iso_date_time(v.c_str(), v.size(), value);
+        sum += value.time_since_epoch().count();
+      }
+      bench::keep(sum);
+    }) / values;
+
+    std::cout << "ns/value " << f.name << ": previous " << reference << ", parse_iso_date_time " << parsed
+              << std::endl;
+
+    // Sanity check: both implementations agree
+    for (const auto& v : text)
+    {
+      ::sqlpp::chrono::microsecond_point value;
+      if (!sqlpp::postgresql::detail::parse_iso_date_time(v.c_str(), v.size(), value) ||
+          value != previous::parse(v.c_str(), v.size()))
+      {
+        throw std::runtime_error("Unexpected result for " + v);
+      }
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,323 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_POSTGRESQL_FAKE_LIBPQ_H
+#define SQLPP_POSTGRESQL_FAKE_LIBPQ_H
+
+#include <sqlpp11/postgresql/dynamic_libpq.h>
+
+#ifndef SQLPP_DYNAMIC_LOADING
+#error "The fake libpq replaces the functions loaded by init_pg(), link sqlpp11-connector-postgresql-dynamic"
+#endif
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "detail/binary_format.h"
+
+// An in-process stand-in for the server. With SQLPP_DYNAMIC_LOADING every libpq call of the connector goes through a
+// function pointer, install() points the connection level functions at fakes that answer every query with the same
+// synthetic result, built once with the real libpq. Result decoding and parameter binding can then be measured and
+// profiled without a server, a network or any jitter from either.
+//
+//   fake_libpq::install({fake_libpq::bigint_column("alpha", false), fake_libpq::text_column("gamma", false)}, 1000);
+//   sqlpp::postgresql::connection db(config);  // no server involved
+//   for (const auto& row : db(select(tab.alpha, tab.gamma).from(tab).unconditionally())) ...
+//
+// SELECT, WITH, VALUES and FETCH statements and all prepared statements return the rows, other statements succeed
+// without rows. The columns are not checked against the statement: they must match the selected columns in number,
+// type and format (binary columns for connection_config::binary_results).
+namespace fake_libpq
+{
+  namespace dyn = sqlpp::postgresql::dynamic;
+
+  // One column of the synthetic results
+  struct column_t
+  {
+    std::string name;
+    Oid type;
+    // 0 for text, 1 for binary
+    int format;
+    // The value of a row in the format of the column
+    std::function<std::string(int row)> value;
+    // Every nth row is NULL, 0 for none
+    int null_every{0};
+
+    column_t(std::string name_, Oid type_, int format_, std::function<std::string(int)> value_)
+        : name(std::move(name_)), type(type_), format(format_), value(std::move(value_))
+    {
+    }
+  };
+
+  namespace detail
+  {
+    struct state_t
+    {
+      // The real libpq, for the results
+      decltype(dyn::PQclear) clear{nullptr};
+      decltype(dyn::PQmakeEmptyPGresult) make_empty{nullptr};
+      PGresult* rows{nullptr};
+      PGresult* command{nullptr};
+      // Results handed out so far, statements may still hold on to them after install() changed the shape
+      std::vector<PGresult*> shared;
+      bool in_transaction{false};
+      char error[1]{};
+    };
+
+    inline state_t& state()
+    {
+      static state_t instance;
+      return instance;
+    }
+
+    inline bool starts_with(const char* statement, const char* keyword)
+    {
+      while (std::isspace(static_cast<unsigned char>(*statement)))
+      {
+        ++statement;
+      }
+      for (; *keyword; ++statement, ++keyword)
+      {
+        if (std::toupper(static_cast<unsigned char>(*statement)) != *keyword)
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    inline PGresult* answer(const char* statement)
+    {
+      auto& s = state();
+      if (starts_with(statement, "BEGIN") || starts_with(statement, "START TRANSACTION"))
+      {
+        s.in_transaction = true;
+      }
+      else if (starts_with(statement, "COMMIT") || starts_with(statement, "ROLLBACK") ||
+               starts_with(statement, "END"))
+      {
+        s.in_transaction = false;
+      }
+      else if (starts_with(statement, "SELECT") || starts_with(statement, "WITH") ||
+               starts_with(statement, "VALUES") || starts_with(statement, "FETCH"))
+      {
+        return s.rows;
+      }
+      return s.command;
+    }
+
+    inline int64_t microseconds(int row)
+    {
+      return static_cast<int64_t>(row) * 61000123 % (int64_t{28} * 86400 * 1000000);
+    }
+  }  // namespace detail
+
+  inline column_t bigint_column(std::string name, bool binary)
+  {
+    return column_t{std::move(name), 20, binary ? 1 : 0, [binary](int row) {
+              const int64_t value = static_cast<int64_t>(row) * 7919;
+              if (!binary)
+              {
+                return std::to_string(value);
+              }
+              std::string out;
+              sqlpp::postgresql::detail::append_int64(out, value);
+              return out;
+            }};
+  }
+
+  inline column_t double_column(std::string name, bool binary)
+  {
+    return column_t{std::move(name), 701, binary ? 1 : 0, [binary](int row) {
+              const double value = row * 0.25;
+              if (!binary)
+              {
+                return std::to_string(value);
+              }
+              std::string out;
+              sqlpp::postgresql::detail::append_float8(out, value);
+              return out;
+            }};
+  }
+
+  inline column_t boolean_column(std::string name, bool binary)
+  {
+    return column_t{std::move(name), 16, binary ? 1 : 0, [binary](int row) {
+              const bool value = row % 2 == 0;
+              return binary ? std::string(1, value ? '\1' : '\0') : std::string(value ? "t" : "f");
+            }};
+  }
+
+  // Text of 32 characters and more
+  inline column_t text_column(std::string name, bool binary)
+  {
+    return column_t{std::move(name), 25, binary ? 1 : 0,
+            [](int row) { return "0123456789abcdef0123456789abcdef" + std::to_string(row); }};
+  }
+
+  // Dates in March 2026
+  inline column_t date_column(std::string name, bool binary)
+  {
+    return column_t{std::move(name), 1082, binary ? 1 : 0, [binary](int row) {
+              const int day = row % 28;
+              if (binary)
+              {
+                std::string out;
+                sqlpp::postgresql::detail::append_int32(out, 9556 + day);
+                return out;
+              }
+              char text[16];
+              std::snprintf(text, sizeof(text), "2026-03-%02d", day + 1);
+              return std::string(text);
+            }};
+  }
+
+  // Timestamps with microseconds in March 2026, in UTC
+  inline column_t timestamptz_column(std::string name, bool binary)
+  {
+    return column_t{std::move(name), 1184, binary ? 1 : 0, [binary](int row) {
+              const int64_t value = detail::microseconds(row);
+              if (binary)
+              {
+                std::string out;
+                sqlpp::postgresql::detail::append_int64(out, int64_t{9556} * 86400 * 1000000 + value);
+                return out;
+              }
+              const int64_t seconds = value / 1000000;
+              char text[64];
+              std::snprintf(text, sizeof(text), "2026-03-%02d %02d:%02d:%02d.%06d+00",
+                            static_cast<int>(seconds / 86400 + 1), static_cast<int>(seconds / 3600 % 24),
+                            static_cast<int>(seconds / 60 % 60), static_cast<int>(seconds % 60),
+                            static_cast<int>(value % 1000000));
+              return std::string(text);
+            }};
+  }
+
+  // Builds a result of the given shape with the real libpq
+  inline PGresult* make_result(const std::vector<column_t>& columns, int rows)
+  {
+    PGresult* result = detail::state().make_empty(nullptr, PGRES_TUPLES_OK);
+    std::vector<PGresAttDesc> attributes(columns.size());
+    for (size_t i = 0; i < columns.size(); ++i)
+    {
+      attributes[i].name = const_cast<char*>(columns[i].name.c_str());
+      attributes[i].format = columns[i].format;
+      attributes[i].typid = columns[i].type;
+      attributes[i].typlen = -1;
+      attributes[i].atttypmod = -1;
+    }
+    if (!dyn::PQsetResultAttrs(result, static_cast<int>(attributes.size()), attributes.data()))
+    {
+      detail::state().clear(result);
+      throw std::runtime_error("PQsetResultAttrs failed");
+    }
+    for (int row = 0; row < rows; ++row)
+    {
+      for (size_t i = 0; i < columns.size(); ++i)
+      {
+        const auto& column = columns[i];
+        if (column.null_every && row % column.null_every == 0)
+        {
+          dyn::PQsetvalue(result, row, static_cast<int>(i), nullptr, -1);
+          continue;
+        }
+        auto value = column.value(row);
+        dyn::PQsetvalue(result, row, static_cast<int>(i), &value[0], static_cast<int>(value.size()));
+      }
+    }
+    return result;
+  }
+
+  // Replaces the connection level functions of libpq, from now on all connections talk to the fake. Call again to
+  // change the shape of the results.
+  inline void install(const std::vector<column_t>& columns, int rows)
+  {
+    dyn::init_pg("");
+    auto& s = detail::state();
+    if (!s.clear)
+    {
+      s.clear = dyn::PQclear;
+      s.make_empty = dyn::PQmakeEmptyPGresult;
+      s.command = s.make_empty(nullptr, PGRES_COMMAND_OK);
+      s.shared.push_back(s.command);
+    }
+    s.rows = make_result(columns, rows);
+    s.shared.push_back(s.rows);
+
+    dyn::PQconnectdb = [](const char*) { return reinterpret_cast<PGconn*>(&detail::state()); };
+    dyn::PQstatus = [](const PGconn*) { return CONNECTION_OK; };
+    dyn::PQfinish = [](PGconn*) {};
+    dyn::PQerrorMessage = [](const PGconn*) { return detail::state().error; };
+    dyn::PQtransactionStatus = [](const PGconn*) {
+      return detail::state().in_transaction ? PQTRANS_INTRANS : PQTRANS_IDLE;
+    };
+    // The results are shared by all statements
+    dyn::PQclear = [](PGresult* result) {
+      auto& state = detail::state();
+      if (std::find(state.shared.begin(), state.shared.end(), result) == state.shared.end())
+      {
+        state.clear(result);
+      }
+    };
+    dyn::PQmakeEmptyPGresult = [](PGconn*, ExecStatusType status) {
+      return detail::state().make_empty(nullptr, status);
+    };
+    dyn::PQescapeStringConn = [](PGconn*, char* to, const char* from, size_t length, int* error) {
+      size_t written = 0;
+      for (size_t i = 0; i < length && from[i]; ++i)
+      {
+        if (from[i] == '\'')
+        {
+          to[written++] = '\'';
+        }
+        to[written++] = from[i];
+      }
+      to[written] = '\0';
+      if (error)
+      {
+        *error = 0;
+      }
+      return written;
+    };
+    dyn::PQexec = [](PGconn*, const char* statement) { return detail::answer(statement); };
+    dyn::PQexecParams = [](PGconn*, const char* statement, int, const Oid*, const char* const*, const int*, const int*,
+                           int) { return detail::answer(statement); };
+    dyn::PQprepare = [](PGconn*, const char*, const char*, int, const Oid*) { return detail::state().command; };
+    dyn::PQexecPrepared = [](PGconn*, const char*, int, const char* const*, const int*, const int*, int) {
+      return detail::state().rows;
+    };
+  }
+}  // namespace fake_libpq
+
+#endif
@@ -0,0 +1,146 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_POSTGRESQL_LOCAL_CLUSTER_H
+#define SQLPP_POSTGRESQL_LOCAL_CLUSTER_H
+
+#include <sqlpp11/postgresql/connection_config.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+// Directory of initdb and pg_ctl including the trailing separator, empty to search the PATH
+#ifndef SQLPP_BENCH_PG_BINDIR
+#define SQLPP_BENCH_PG_BINDIR ""
+#endif
+
+namespace bench
+{
+  // A throwaway cluster in a temporary directory, created with initdb and started with pg_ctl, so that the benchmarks
+  // against a server run against the same fresh configuration every time. The server only listens on a unix socket in
+  // that directory and is stopped and removed again at the end of the run.
+  //
+  // Falls back to the database with the name of the current user (like the tests) if the cluster cannot be set up,
+  // e.g. without initdb or as root, which initdb refuses.
+  class local_cluster_t
+  {
+    std::string _directory;
+    bool _running{false};
+    std::shared_ptr<sqlpp::postgresql::connection_config> _config;
+
+    static bool run(const std::string& command)
+    {
+      return std::system(command.c_str()) == 0;
+    }
+
+    bool start()
+    {
+#ifdef _WIN32
+      return false;
+#else
+      const char* tmp = std::getenv("TMPDIR");
+      std::string pattern = std::string(tmp && *tmp ? tmp : "/tmp") + "/sqlpp11-bench-XXXXXX";
+      if (!mkdtemp(&pattern[0]))
+      {
+        return false;
+      }
+      _directory = pattern;
+
+      const std::string bin = SQLPP_BENCH_PG_BINDIR;
+      const std::string data = _directory + "/data";
+      if (!run("\"" + bin + "initdb\" -D \"" + data + "\" -A trust -U bench -E UTF8 --no-sync > \"" + _directory +
+               "/initdb.log\" 2>&1"))
+      {
+        std::cout << "initdb failed, see " << _directory << "/initdb.log" << std::endl;
+        return false;
+      }
+      if (!run("\"" + bin + "pg_ctl\" -D \"" + data + "\" -l \"" + _directory + "/server.log\" -w -o \"-c " +
+               "listen_addresses='' -k '" + _directory + "'\" start > /dev/null 2>&1"))
+      {
+        std::cout << "pg_ctl start failed, see " << _directory << "/server.log" << std::endl;
+        return false;
+      }
+      _running = true;
+
+      _config->host = _directory;
+      _config->dbname = "postgres";
+      _config->user = "bench";
+      return true;
+#endif
+    }
+
+  public:
+    local_cluster_t() : _config(std::make_shared<sqlpp::postgresql::connection_config>())
+    {
+      if (!start())
+      {
+        const char* user = std::getenv("USER");
+        _config->host.clear();
+        _config->dbname = user ? user : "";
+        _config->user = _config->dbname;
+        std::cout << "No local cluster, using database \"" << _config->dbname << "\"" << std::endl;
+      }
+    }
+
+    local_cluster_t(const local_cluster_t&) = delete;
+    local_cluster_t& operator=(const local_cluster_t&) = delete;
+
+    ~local_cluster_t()
+    {
+#ifndef _WIN32
+      // After a failed setup the directory is kept for its logs
+      if (_running)
+      {
+        run("\"" + std::string(SQLPP_BENCH_PG_BINDIR) + "pg_ctl\" -D \"" + _directory +
+            "/data\" -m immediate stop > /dev/null 2>&1");
+        run("rm -rf \"" + _directory + "\"");
+      }
+#endif
+    }
+
+    // A copy that the benchmark may change, e.g. to enable binary results
+    std::shared_ptr<sqlpp::postgresql::connection_config> config() const
+    {
+      return std::make_shared<sqlpp::postgresql::connection_config>(*_config);
+    }
+  };
+
+  // The cluster of this run, started on first use
+  inline local_cluster_t& local_cluster()
+  {
+    static local_cluster_t cluster;
+    return cluster;
+  }
+}  // namespace bench
+
+#endif
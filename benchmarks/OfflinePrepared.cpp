@@ -0,0 +1,78 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "Benchmark.h"
+#include "FakeLibpq.h"
+#include "TabFoo.h"
+
+#include <sqlpp11/postgresql/postgresql.h>
+#include <sqlpp11/sqlpp11.h>
+
+#include <cstdint>
+
+namespace sql = sqlpp::postgresql;
+
+namespace
+{
+  // Binding and executing an insert with parameters of every kind, like PreparedExecute but without the server: the
+  // execute measures what the connector does around the round trip
+  void measure_executes(const std::string& name, bool binary)
+  {
+    fake_libpq::install({}, 0);
+    auto config = std::make_shared<sql::connection_config>();
+    config->binary_parameters = binary;
+    sql::connection db(config);
+
+    model::TabFoo tab = {};
+    auto prepared = db.prepare(insert_into(tab).set(tab.beta = parameter(tab.beta), tab.gamma = parameter(tab.gamma),
+                                                    tab.c_bool = parameter(tab.c_bool),
+                                                    tab.c_timepoint = parameter(tab.c_timepoint),
+                                                    tab.c_day = parameter(tab.c_day)));
+    const auto now = ::sqlpp::chrono::floor<::std::chrono::microseconds>(std::chrono::system_clock::now());
+    prepared.params.gamma = "benchmark";
+    prepared.params.c_timepoint = now;
+    prepared.params.c_day = ::sqlpp::chrono::floor<::sqlpp::chrono::days>(now);
+
+    int64_t i = 0;
+    bench::measure(name + ": bind", 1000000, [&] {
+      prepared.params.beta = ++i % 1000;
+      prepared.params.c_bool = (i % 2 == 0);
+      prepared._bind_params();
+    });
+    bench::measure(name + ": execute", 1000000, [&] {
+      prepared.params.beta = ++i % 1000;
+      prepared.params.c_bool = (i % 2 == 0);
+      bench::keep(db(prepared));
+    });
+  }
+}
+
+int OfflinePrepared(int, char*[])
+{
+  measure_executes("text parameters", false);
+  measure_executes("binary parameters", true);
+  return 0;
+}
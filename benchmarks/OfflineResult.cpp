@@ -0,0 +1,118 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "Benchmark.h"
+#include "FakeLibpq.h"
+#include "TabFoo.h"
+
+#include <sqlpp11/postgresql/postgresql.h>
+#include <sqlpp11/sqlpp11.h>
+
+#include <cstdint>
+
+namespace sql = sqlpp::postgresql;
+
+namespace
+{
+  const int tall_rows = 100000;
+  const int wide_rows = 1000;
+
+  // The columns of tabfoo, every tenth gamma is NULL
+  std::vector<fake_libpq::column_t> tabfoo_columns(bool binary)
+  {
+    auto gamma = fake_libpq::text_column("gamma", binary);
+    gamma.null_every = 10;
+    return {fake_libpq::bigint_column("alpha", binary),
+            fake_libpq::bigint_column("beta", binary),
+            gamma,
+            fake_libpq::boolean_column("c_bool", binary),
+            fake_libpq::timestamptz_column("c_timepoint", binary),
+            fake_libpq::date_column("c_day", binary)};
+  }
+
+  // Iterating over the rows of prepared selects through bind_result_t, like ResultIteration but without the server:
+  // only the client side decoding is measured
+  void measure_results(const std::string& name, bool binary)
+  {
+    fake_libpq::install(tabfoo_columns(binary), tall_rows);
+    auto config = std::make_shared<sql::connection_config>();
+    config->binary_results = binary;
+    sql::connection db(config);
+    model::TabFoo tab = {};
+
+    // Many rows of all six columns
+    auto tall = db.prepare(select(all_of(tab)).from(tab).unconditionally());
+    const double tall_ns = bench::measure(name + ": tall", 20, [&] {
+      int64_t sum = 0;
+      for (const auto& row : db(tall))
+      {
+        sum += row.alpha.value() + static_cast<int64_t>(row.gamma.value().size());
+      }
+      bench::keep(sum);
+    });
+
+    // Few rows of 24 columns
+    std::vector<fake_libpq::column_t> wide_columns;
+    for (int i = 0; i < 4; ++i)
+    {
+      const auto columns = tabfoo_columns(binary);
+      wide_columns.insert(wide_columns.end(), columns.begin(), columns.end());
+    }
+    fake_libpq::install(wide_columns, wide_rows);
+    auto wide = db.prepare(select(tab.alpha.as(sqlpp::alias::a), tab.beta.as(sqlpp::alias::b),
+                                  tab.gamma.as(sqlpp::alias::c), tab.c_bool.as(sqlpp::alias::d),
+                                  tab.c_timepoint.as(sqlpp::alias::e), tab.c_day.as(sqlpp::alias::f),
+                                  tab.alpha.as(sqlpp::alias::g), tab.beta.as(sqlpp::alias::h),
+                                  tab.gamma.as(sqlpp::alias::i), tab.c_bool.as(sqlpp::alias::j),
+                                  tab.c_timepoint.as(sqlpp::alias::k), tab.c_day.as(sqlpp::alias::l),
+                                  tab.alpha.as(sqlpp::alias::m), tab.beta.as(sqlpp::alias::n),
+                                  tab.gamma.as(sqlpp::alias::o), tab.c_bool.as(sqlpp::alias::p),
+                                  tab.c_timepoint.as(sqlpp::alias::q), tab.c_day.as(sqlpp::alias::r),
+                                  tab.alpha.as(sqlpp::alias::s), tab.beta.as(sqlpp::alias::t),
+                                  tab.gamma.as(sqlpp::alias::u), tab.c_bool.as(sqlpp::alias::v),
+                                  tab.c_timepoint.as(sqlpp::alias::w), tab.c_day.as(sqlpp::alias::x))
+                               .from(tab)
+                               .unconditionally());
+    const double wide_ns = bench::measure(name + ": wide", 2000, [&] {
+      int64_t sum = 0;
+      for (const auto& row : db(wide))
+      {
+        sum += row.a.value() + row.x.value().time_since_epoch().count();
+      }
+      bench::keep(sum);
+    });
+
+    std::cout << name << ": " << tall_ns / (tall_rows * 6) << " ns/cell tall, " << wide_ns / (wide_rows * 24)
+              << " ns/cell wide" << std::endl;
+  }
+}
+
+int OfflineResult(int, char*[])
+{
+  measure_results("text results", false);
+  measure_results("binary results", true);
+  return 0;
+}
@@ -0,0 +1,96 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "Benchmark.h"
+#include "LocalCluster.h"
+#include "TabFoo.h"
+
+#include <sqlpp11/postgresql/postgresql.h>
+#include <sqlpp11/sqlpp11.h>
+
+namespace sql = sqlpp::postgresql;
+
+namespace
+{
+  // Binding and executing an insert with parameters of every kind against a local server
+  void measure_executes(const std::string& name, const std::shared_ptr<sql::connection_config>& config)
+  {
+    sql::connection db(config);
+    db.execute(R"(DROP TABLE IF EXISTS tabfoo;)");
+    db.execute(R"(CREATE TABLE tabfoo
+                 (
+                   alpha bigserial NOT NULL,
+                   beta smallint,
+                   gamma text,
+                   c_bool boolean,
+                   c_timepoint timestamp with time zone,
+                   c_day date
+                 ))");
+
+    model::TabFoo tab = {};
+    auto prepared = db.prepare(insert_into(tab).set(tab.beta = parameter(tab.beta), tab.gamma = parameter(tab.gamma),
+                                                    tab.c_bool = parameter(tab.c_bool),
+                                                    tab.c_timepoint = parameter(tab.c_timepoint),
+                                                    tab.c_day = parameter(tab.c_day)));
+    const auto now = ::sqlpp::chrono::floor<::std::chrono::microseconds>(std::chrono::system_clock::now());
+    prepared.params.gamma = "benchmark";
+    prepared.params.c_timepoint = now;
+    prepared.params.c_day = ::sqlpp::chrono::floor<::sqlpp::chrono::days>(now);
+
+    // Only the conversion of the parameters into the statement handle, without the round trip
+    int64_t i = 0;
+    bench::measure(name + ": bind", 200000, [&] {
+      prepared.params.beta = ++i % 1000;
+      prepared.params.c_bool = (i % 2 == 0);
+      prepared._bind_params();
+    });
+
+    auto transaction = start_transaction(db);
+    const double ns = bench::measure(name + ": execute", 20000, [&] {
+      prepared.params.beta = ++i % 1000;
+      prepared.params.c_bool = (i % 2 == 0);
+      bench::keep(db(prepared));
+    });
+    transaction.rollback();
+    std::cout << name << ": " << static_cast<int64_t>(1e9 / ns) << " executes/s" << std::endl;
+  }
+}
+
+int PreparedExecute(int, char*[])
+{
+  try
+  {
+    measure_executes("text parameters", bench::local_cluster().config());
+    auto binary = bench::local_cluster().config();
+    binary->binary_parameters = true;
+    measure_executes("binary parameters", binary);
+  }
+  catch (const sql::broken_connection& e)
+  {
+    std::cout << "PreparedExecute skipped, no server: " << e.what() << std::endl;
+  }
+  return 0;
+}
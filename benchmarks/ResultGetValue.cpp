@@ -0,0 +1,127 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "Benchmark.h"
+
+#include <sqlpp11/postgresql/result.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+  const int rows = 1000;
+
+  // Builds a result in memory, so the decoding cost is measured without a server round trip
+  PGresult* make_result()
+  {
+    PGresult* result = PQmakeEmptyPGresult(nullptr, PGRES_TUPLES_OK);
+    PGresAttDesc attributes[3] = {};
+    attributes[0].name = const_cast<char*>("small");
+    attributes[0].typid = 20;
+    attributes[0].typlen = 8;
+    attributes[1].name = const_cast<char*>("large");
+    attributes[1].typid = 20;
+    attributes[1].typlen = 8;
+    attributes[2].name = const_cast<char*>("real");
+    attributes[2].typid = 701;
+    attributes[2].typlen = 8;
+    if (!PQsetResultAttrs(result, 3, attributes))
+    {
+      PQclear(result);
+      throw std::runtime_error("PQsetResultAttrs failed");
+    }
+
+    for (int row = 0; row < rows; ++row)
+    {
+      const std::string values[3] = {std::to_string(row), std::to_string(INT64_C(9007199254740993) * (row % 1000 + 1)),
+                                     std::to_string(row * 0.25)};
+      for (int field = 0; field < 3; ++field)
+      {
+        PQsetvalue(result, row, field, const_cast<char*>(values[field].c_str()), static_cast<int>(values[field].size()));
+      }
+    }
+    return result;
+  }
+}
+
+int ResultGetValue(int, char*[])
+{
+  sqlpp::postgresql::Result result;
+  result = make_result();
+
+  const std::size_t iterations = 2000;
+  const double cells = rows;
+
+  // The previous implementation, kept as the reference point
+  const double reference = bench::measure("std::stold (previous)", iterations, [&result] {
+    int64_t sum = 0;
+    for (int row = 0; row < rows; ++row)
+    {
+      sum += static_cast<int64_t>(std::stold(std::string(result.getValue(row, 1))));
+    }
+    bench::keep(sum);
+  }) / cells;
+
+  const double small = bench::measure("getValue<int64_t> small", iterations, [&result] {
+    int64_t sum = 0;
+    for (int row = 0; row < rows; ++row)
+    {
+      sum += result.getValue<int64_t>(row, 0);
+    }
+    bench::keep(sum);
+  }) / cells;
+
+  const double large = bench::measure("getValue<int64_t> large", iterations, [&result] {
+    int64_t sum = 0;
+    for (int row = 0; row < rows; ++row)
+    {
+      sum += result.getValue<int64_t>(row, 1);
+    }
+    bench::keep(sum);
+  }) / cells;
+
+  const double real = bench::measure("getValue<double>", iterations, [&result] {
+    double sum = 0;
+    for (int row = 0; row < rows; ++row)
+    {
+      sum += result.getValue<double>(row, 2);
+    }
+    bench::keep(sum);
+  }) / cells;
+
+  std::cout << "ns/cell: stold " << reference << ", int64 small " << small << ", int64 large " << large
+            << ", double " << real << std::endl;
+
+  // Sanity check: values above 2^53 must survive the round trip exactly
+  if (result.getValue<int64_t>(1, 1) != INT64_C(9007199254740993) * 2)
+  {
+    throw std::runtime_error("Unexpected result");
+  }
+  return 0;
+}
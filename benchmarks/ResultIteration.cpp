@@ -0,0 +1,120 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "Benchmark.h"
+#include "LocalCluster.h"
+#include "TabFoo.h"
+
+#include <sqlpp11/postgresql/postgresql.h>
+#include <sqlpp11/sqlpp11.h>
+
+#include <cstdint>
+
+namespace sql = sqlpp::postgresql;
+
+namespace
+{
+  const int tall_rows = 100000;
+  const int wide_rows = 1000;
+
+  // Iterating over the rows of prepared selects through bind_result_t. The times include the transfer from the
+  // local server, compare the text and binary formats or runs before and after a change.
+  void measure_results(const std::string& name, const std::shared_ptr<sql::connection_config>& config)
+  {
+    sql::connection db(config);
+    model::TabFoo tab = {};
+
+    // Many rows of all six columns
+    auto tall = db.prepare(select(all_of(tab)).from(tab).unconditionally());
+    const double tall_ns = bench::measure(name + ": tall", 10, [&] {
+      int64_t sum = 0;
+      for (const auto& row : db(tall))
+      {
+        sum += row.alpha.value() + static_cast<int64_t>(row.gamma.value().size());
+      }
+      bench::keep(sum);
+    });
+
+    // Few rows of 24 columns
+    auto wide = db.prepare(select(tab.alpha.as(sqlpp::alias::a), tab.beta.as(sqlpp::alias::b),
+                                  tab.gamma.as(sqlpp::alias::c), tab.c_bool.as(sqlpp::alias::d),
+                                  tab.c_timepoint.as(sqlpp::alias::e), tab.c_day.as(sqlpp::alias::f),
+                                  tab.alpha.as(sqlpp::alias::g), tab.beta.as(sqlpp::alias::h),
+                                  tab.gamma.as(sqlpp::alias::i), tab.c_bool.as(sqlpp::alias::j),
+                                  tab.c_timepoint.as(sqlpp::alias::k), tab.c_day.as(sqlpp::alias::l),
+                                  tab.alpha.as(sqlpp::alias::m), tab.beta.as(sqlpp::alias::n),
+                                  tab.gamma.as(sqlpp::alias::o), tab.c_bool.as(sqlpp::alias::p),
+                                  tab.c_timepoint.as(sqlpp::alias::q), tab.c_day.as(sqlpp::alias::r),
+                                  tab.alpha.as(sqlpp::alias::s), tab.beta.as(sqlpp::alias::t),
+                                  tab.gamma.as(sqlpp::alias::u), tab.c_bool.as(sqlpp::alias::v),
+                                  tab.c_timepoint.as(sqlpp::alias::w), tab.c_day.as(sqlpp::alias::x))
+                               .from(tab)
+                               .where(tab.alpha <= wide_rows));
+    const double wide_ns = bench::measure(name + ": wide", 200, [&] {
+      int64_t sum = 0;
+      for (const auto& row : db(wide))
+      {
+        sum += row.a.value() + row.x.value().time_since_epoch().count();
+      }
+      bench::keep(sum);
+    });
+
+    std::cout << name << ": " << tall_ns / (tall_rows * 6) << " ns/cell tall, " << wide_ns / (wide_rows * 24)
+              << " ns/cell wide" << std::endl;
+  }
+}
+
+int ResultIteration(int, char*[])
+{
+  try
+  {
+    sql::connection db(bench::local_cluster().config());
+    db.execute(R"(DROP TABLE IF EXISTS tabfoo;)");
+    db.execute(R"(CREATE TABLE tabfoo
+                 (
+                   alpha bigserial NOT NULL,
+                   beta smallint,
+                   gamma text,
+                   c_bool boolean,
+                   c_timepoint timestamp with time zone,
+                   c_day date
+                 ))");
+    db.execute(R"(INSERT INTO tabfoo (beta, gamma, c_bool, c_timepoint, c_day)
+                  SELECT i % 1000, md5(i::text), i % 2 = 0, now() - i * interval '1 minute', current_date - i % 1000
+                  FROM generate_series(1, )" +
+               std::to_string(tall_rows) + ") i");
+
+    measure_results("text results", bench::local_cluster().config());
+    auto binary = bench::local_cluster().config();
+    binary->binary_results = true;
+    measure_results("binary results", binary);
+  }
+  catch (const sql::broken_connection& e)
+  {
+    std::cout << "ResultIteration skipped, no server: " << e.what() << std::endl;
+  }
+  return 0;
+}
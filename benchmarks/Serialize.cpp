@@ -0,0 +1,81 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "Benchmark.h"
+#include "LocalCluster.h"
+#include "TabFoo.h"
+
+#include <sqlpp11/postgresql/postgresql.h>
+#include <sqlpp11/sqlpp11.h>
+
+namespace sql = sqlpp::postgresql;
+
+namespace
+{
+  template <typename Statement>
+  void measure_statement(const std::string& name, sql::connection& db, const Statement& statement)
+  {
+    // A context per statement, like connection::operator()
+    bench::measure(name + ", new context", 200000, [&] {
+      sql::context_t context(db);
+      serialize(statement, context);
+      bench::keep(context.str().size());
+    });
+
+    // One context for many statements, e.g. when building a script
+    sql::context_t context(db);
+    bench::measure(name + ", reused context", 200000, [&] {
+      context.reset();
+      serialize(statement, context);
+      bench::keep(context.str().size());
+    });
+  }
+}
+
+int Serialize(int, char*[])
+{
+  try
+  {
+    // The connection is only used for escaping text literals
+    sql::connection db(bench::local_cluster().config());
+    model::TabFoo tab = {};
+
+    measure_statement("select", db,
+                      select(all_of(tab))
+                          .from(tab)
+                          .where(tab.alpha > 17 && tab.gamma == "it's" && tab.beta.in(1, 2, 3) &&
+                                 tab.c_bool.is_not_null()));
+    measure_statement("insert", db,
+                      insert_into(tab).set(tab.beta = 7, tab.gamma = "benchmark", tab.c_bool = true));
+    measure_statement("update", db,
+                      update(tab).set(tab.gamma = "updated", tab.beta = tab.beta + 1).where(tab.alpha == 42));
+  }
+  catch (const sql::broken_connection& e)
+  {
+    std::cout << "Serialize skipped, no server: " << e.what() << std::endl;
+  }
+  return 0;
+}
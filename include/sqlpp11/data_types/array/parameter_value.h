@@ -0,0 +1,102 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_ARRAY_PARAMETER_VALUE_H
+#define SQLPP_ARRAY_PARAMETER_VALUE_H
+
+#include <cstddef>
+
+#include <sqlpp11/data_types/parameter_value.h>
+#include <sqlpp11/data_types/array/data_type.h>
+#include <sqlpp11/null.h>
+
+namespace sqlpp
+{
+  template <typename ValueType>
+  struct array_parameter_value_base
+  {
+    using _value_type = array<ValueType>;
+    using _cpp_value_type = typename _value_type::_cpp_value_type;
+
+    array_parameter_value_base() : _value{}, _is_null(true)
+    {
+    }
+
+    array_parameter_value_base& operator=(const _cpp_value_type& value)
+    {
+      _value = value;
+      _is_null = false;
+      return *this;
+    }
+
+    array_parameter_value_base& operator=(const ::sqlpp::null_t&)
+    {
+      set_null();
+      return *this;
+    }
+
+    void set_null()
+    {
+      _value.clear();
+      _is_null = true;
+    }
+
+    bool is_null() const
+    {
+      return _is_null;
+    }
+
+    const _cpp_value_type& value() const
+    {
+      return _value;
+    }
+
+    operator _cpp_value_type() const
+    {
+      return _value;
+    }
+
+    _cpp_value_type _value;
+    bool _is_null;
+  };
+
+  template <typename ValueType>
+  struct parameter_value_t<array<ValueType>> : public array_parameter_value_base<ValueType>
+  {
+    using base = array_parameter_value_base<ValueType>;
+    using base::base;
+    using base::operator=;
+
+    template <typename Target>
+    void _bind(Target& target, size_t index) const
+    {
+      target._bind_array_parameter(index, &this->_value, this->_is_null);
+    }
+  };
+}  // namespace sqlpp
+
+#endif
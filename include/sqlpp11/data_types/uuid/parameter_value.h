@@ -28,6 +28,7 @@
 #ifndef SQLPP_UUID_PARAMETER_VALUE_H
 #define SQLPP_UUID_PARAMETER_VALUE_H
 
+#include <sqlpp11/data_types/array/parameter_value.h>
 #include <sqlpp11/data_types/parameter_value.h>
 #include <sqlpp11/data_types/parameter_value_base.h>
 #include <sqlpp11/data_types/uuid/data_type.h>
@@ -51,6 +52,26 @@ namespace sqlpp
       target._bind_text_parameter(index, &val, _is_null);
     }
   };
+
+  template <>
+  struct parameter_value_t<array<uuid>> : public array_parameter_value_base<uuid>
+  {
+    using base = array_parameter_value_base<uuid>;
+    using base::base;
+    using base::operator=;
+
+    template <typename Target>
+    void _bind(Target& target, size_t index) const
+    {
+      std::string val;
+      val.reserve(this->_value.size() * 16);
+      for (const auto& element : this->_value)
+      {
+        val.append(reinterpret_cast<const char*>(element.data), 16);
+      }
+      target._bind_uuid_array_parameter(index, &val, this->_is_null);
+    }
+  };
 }  // namespace sqlpp
 
 #endif
@@ -0,0 +1,96 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_POSTGRESQL_ASYNC_RESULT_H
+#define SQLPP_POSTGRESQL_ASYNC_RESULT_H
+
+#include <cstddef>
+#include <memory>
+
+#include <sqlpp11/postgresql/bind_result.h>
+#include <sqlpp11/postgresql/visibility.h>
+#include <sqlpp11/result.h>
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+    namespace detail
+    {
+      struct async_handle_t;
+    }
+
+    // Result of a statement sent with one of the connection::async_* functions. Use socket() to wait for the
+    // connection in an event loop and ready() to check whether the result arrived, without blocking. Accessing the
+    // result blocks until it is there and throws the error of the statement, if any. Until then the connection cannot
+    // run other statements. Destroying it before the result arrived cancels the statement.
+    class DLL_PUBLIC async_result_t
+    {
+    protected:
+      std::shared_ptr<detail::async_handle_t> _handle;
+
+      bind_result_t _bind_result();
+
+    public:
+      async_result_t(const std::shared_ptr<detail::async_handle_t>& handle);
+
+      // Socket of the connection, to wait for readability (or writability while !flushed())
+      int socket() const;
+
+      // Whether the statement was sent completely
+      bool flushed() const;
+
+      // Reads what arrived on the socket, returns true when the result is complete
+      bool ready();
+
+      // Blocks until the result is complete
+      void wait();
+
+      size_t affected_rows();
+    };
+
+    template <typename ResultRow, typename DynamicNames>
+    class async_select_t : public async_result_t
+    {
+    private:
+      DynamicNames _dynamic_names;
+
+    public:
+      async_select_t(async_result_t&& result, const DynamicNames& dynamic_names)
+          : async_result_t(std::move(result)), _dynamic_names(dynamic_names)
+      {
+      }
+
+      ::sqlpp::result_t<bind_result_t, ResultRow> get()
+      {
+        return {_bind_result(), _dynamic_names};
+      }
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,254 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_POSTGRESQL_BATCH_INSERT_H
+#define SQLPP_POSTGRESQL_BATCH_INSERT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <sqlpp11/data_types.h>
+#include <sqlpp11/logic.h>
+#include <sqlpp11/null.h>
+#include <sqlpp11/postgresql/connection.h>
+#include <sqlpp11/postgresql/insert.h>
+#include <sqlpp11/postgresql/prepared_statement.h>
+#include <sqlpp11/postgresql/type_oid.h>
+#include <sqlpp11/result.h>
+#include <sqlpp11/type_traits.h>
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+    namespace detail
+    {
+      // Whether an insert statement has no values yet, i.e. neither set(), default_values() nor columns()
+      template <typename T, typename = void>
+      struct has_no_insert_values : std::false_type
+      {
+      };
+
+      template <typename T>
+      struct has_no_insert_values<T, decltype(void(std::declval<const T&>().no_insert_values))> : std::true_type
+      {
+      };
+    }
+
+    // Inserts ranges of rows with INSERT ... VALUES (...), (...), ... statements of a power of two rows each, see
+    // connection::batch_insert(). The statement for each number of rows is prepared once and reused.
+    template <typename Shape, typename... Columns>
+    class batch_insert_t
+    {
+    private:
+      using _table_t = typename std::tuple_element<0, std::tuple<typename Columns::_table...>>::type;
+      static_assert(::sqlpp::logic::all_t<std::is_same<typename Columns::_table, _table_t>::value...>::value,
+                    "batch_insert() requires columns of one table");
+      static_assert(detail::has_no_insert_values<Shape>::value,
+                    "batch_insert() requires an insert_into(table) statement without values, the rows provide them");
+      // Limit of the protocol on the number of parameters of a statement
+      static constexpr size_t _max_parameters = 65535;
+
+      connection& _db;
+      Shape _shape;
+      // The statement split where the column list and the VALUES go
+      std::string _head;
+      std::string _tail;
+      size_t _max_rows{1024};
+      std::map<size_t, prepared_statement_t> _statements;
+
+      prepared_statement_t& _statement(size_t rows)
+      {
+        auto found = _statements.find(rows);
+        if (found != _statements.end())
+        {
+          return found->second;
+        }
+
+        const size_t columns = sizeof...(Columns);
+        const std::vector<Oid> row_types{detail::parameter_oid<::sqlpp::value_type_of<Columns>>::value...};
+        std::vector<Oid> types;
+        types.reserve(rows * columns);
+        std::string sql = _head;
+        sql.append(" VALUES ");
+        for (size_t row = 0; row < rows; ++row)
+        {
+          sql.append(row == 0 ? "(" : ",(");
+          for (size_t column = 0; column < columns; ++column)
+          {
+            if (column != 0)
+            {
+              sql.push_back(',');
+            }
+            sql.append("$" + std::to_string(row * columns + column + 1));
+          }
+          sql.push_back(')');
+          types.insert(types.end(), row_types.begin(), row_types.end());
+        }
+        sql.append(_tail);
+        return _statements.emplace(rows, _db.prepare_impl(sql, rows * columns, types)).first->second;
+      }
+
+      template <size_t Index, typename Row>
+      typename std::enable_if<(Index < sizeof...(Columns))>::type _bind_row(prepared_statement_t& statement,
+                                                                             size_t offset,
+                                                                             const Row& row)
+      {
+        using _column_t = typename std::tuple_element<Index, std::tuple<Columns...>>::type;
+        _bind<::sqlpp::value_type_of<_column_t>>(statement, offset + Index, std::get<Index>(row));
+        _bind_row<Index + 1>(statement, offset, row);
+      }
+
+      template <size_t Index, typename Row>
+      typename std::enable_if<(Index == sizeof...(Columns))>::type _bind_row(prepared_statement_t&,
+                                                                              size_t,
+                                                                              const Row&)
+      {
+      }
+
+      template <typename ValueType, typename Value>
+      void _bind(prepared_statement_t& statement, size_t index, const Value& value)
+      {
+        ::sqlpp::parameter_value_t<ValueType> parameter;
+        parameter = value;
+        parameter._bind(statement, index);
+      }
+
+      template <typename ValueType>
+      void _bind(prepared_statement_t& statement, size_t index, const ::sqlpp::null_t&)
+      {
+        const std::string none;
+        statement._bind_text_parameter(index, &none, true);
+      }
+
+      // Largest power of two not above the remaining rows and the limits
+      size_t _batch_rows(size_t remaining) const
+      {
+        const size_t limit = std::min(std::min(remaining, _max_rows), _max_parameters / sizeof...(Columns));
+        size_t rows = 1;
+        while (rows * 2 <= limit)
+        {
+          rows *= 2;
+        }
+        return rows;
+      }
+
+      // Binds the next batch of rows and advances the iterator
+      template <typename Iterator>
+      prepared_statement_t& _next_batch(Iterator& row, size_t& remaining)
+      {
+        const size_t rows = _batch_rows(remaining);
+        auto& statement = _statement(rows);
+        for (size_t i = 0; i < rows; ++i, ++row)
+        {
+          _bind_row<0>(statement, i * sizeof...(Columns), *row);
+        }
+        remaining -= rows;
+        return statement;
+      }
+
+    public:
+      batch_insert_t(connection& db, const Shape& shape) : _db(db), _shape(shape)
+      {
+        context_t head(db);
+        serialize(::sqlpp::postgresql::insert_into(_table_t{}), head);
+        context_t full(db);
+        serialize(shape, full);
+        if (full.str().compare(0, head.str().size(), head.str()) != 0)
+        {
+          throw std::invalid_argument("batch_insert() requires an insert_into(table) statement without values");
+        }
+
+        _head = head.str() + " (";
+        const char* names[] = {::sqlpp::name_of<Columns>::char_ptr()...};
+        for (size_t column = 0; column < sizeof...(Columns); ++column)
+        {
+          _head.append(column == 0 ? "" : ",").append(names[column]);
+        }
+        _head.push_back(')');
+        _tail = full.str().substr(head.str().size());
+      }
+
+      // Upper limit of the rows per statement, rounded down to a power of two
+      void max_rows(size_t rows)
+      {
+        _max_rows = std::max<size_t>(rows, 1);
+      }
+
+      // Inserts the rows, each a std::tuple (or anything std::get works on) with one value or sqlpp::null per column.
+      // Returns the number of affected rows. The rows are sent in several statements: outside a transaction the
+      // batches before a failing one stay inserted, run it within a transaction to insert all rows or none.
+      template <typename Rows>
+      size_t run(const Rows& rows)
+      {
+        size_t affected = 0;
+        auto row = std::begin(rows);
+        auto remaining = static_cast<size_t>(std::distance(std::begin(rows), std::end(rows)));
+        while (remaining != 0)
+        {
+          affected += _db.run_prepared_insert_impl(_next_batch(row, remaining));
+        }
+        return affected;
+      }
+
+      // For statements with returning(), calls callback with each returned row. Returns the number of returned rows.
+      template <typename Rows, typename Callback>
+      size_t run(const Rows& rows, Callback callback)
+      {
+        using _result_row_t = typename Shape::template _result_row_t<connection>;
+        size_t returned = 0;
+        auto row = std::begin(rows);
+        auto remaining = static_cast<size_t>(std::distance(std::begin(rows), std::end(rows)));
+        while (remaining != 0)
+        {
+          auto& statement = _next_batch(row, remaining);
+          ::sqlpp::result_t<bind_result_t, _result_row_t> result{_db.run_prepared_select_impl(statement),
+                                                                 _shape.get_dynamic_names()};
+          for (const auto& returned_row : result)
+          {
+            callback(returned_row);
+            ++returned;
+          }
+        }
+        return returned;
+      }
+    };
+
+    template <typename Shape, typename... Columns>
+    constexpr size_t batch_insert_t<Shape, Columns...>::_max_parameters;
+  }
+}
+
+#endif
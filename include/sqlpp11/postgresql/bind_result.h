@@ -28,9 +28,11 @@
 #ifndef SQLPP_POSTGRESQL_BIND_RESULT_H
 #define SQLPP_POSTGRESQL_BIND_RESULT_H
 
+#include <limits>
 #include <memory>
 #include <sqlpp11/chrono.h>
 #include <sqlpp11/data_types.h>
+#include <sqlpp11/postgresql/column_batch.h>
 
 namespace sqlpp
 {
@@ -96,6 +98,15 @@ namespace sqlpp
       void _bind_date_time_result(size_t index, ::sqlpp::chrono::microsecond_point* value, bool* is_null);
 
       int size() const;
+
+      // Decodes up to max_rows of the rows not handed out yet into the columns of the batch, replacing its previous
+      // content but keeping its memory. Returns the number of rows, 0 once the result is exhausted, e.g.
+      //   auto result = db.select(select(tab.alpha, tab.gamma).from(tab).unconditionally());
+      //   sqlpp::postgresql::column_batch_t batch;
+      //   while (result.fetch_columns(batch, 10000))
+      //     aggregate(batch.columns[0].integrals, batch.columns[0].nulls);
+      // Prepared statements work the same, with db.run_prepared_select(prepared).
+      size_t fetch_columns(column_batch_t& batch, size_t max_rows = std::numeric_limits<size_t>::max());
     };
   }  // namespace postgresql
 }  // namespace sqlpp
@@ -0,0 +1,120 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_POSTGRESQL_COLUMN_BATCH_H
+#define SQLPP_POSTGRESQL_COLUMN_BATCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <sqlpp11/chrono.h>
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+    // The values of one column of a result, stored contiguously. Only the vector matching the kind of the column is
+    // filled, NULL values are zero (or empty) there and have their bit set in the null bitmap.
+    struct result_column_t
+    {
+      // Chosen by the type of the column: boolean, smallint/integer/bigint/oid, real/double precision/numeric, date,
+      // timestamp (with or without time zone) and everything else as text
+      enum class kind_t
+      {
+        boolean,
+        integral,
+        floating_point,
+        date,
+        date_time,
+        text
+      };
+
+      std::string name;
+      kind_t kind{kind_t::text};
+
+      // Bit row % 64 of word row / 64 is set for NULL values
+      std::vector<uint64_t> nulls;
+
+      std::vector<uint8_t> booleans;
+      std::vector<int64_t> integrals;
+      std::vector<double> floating_points;
+      std::vector<::sqlpp::chrono::day_point> dates;
+      std::vector<::sqlpp::chrono::microsecond_point> date_times;
+      // The text of row r is data[offsets[r], offsets[r + 1])
+      std::vector<size_t> offsets;
+      std::string data;
+
+      bool is_null(size_t row) const
+      {
+        return (nulls[row / 64] >> (row % 64)) & 1u;
+      }
+
+      const char* text(size_t row) const
+      {
+        return data.data() + offsets[row];
+      }
+
+      size_t text_size(size_t row) const
+      {
+        return offsets[row + 1] - offsets[row];
+      }
+
+      // Empties the column, keeping the allocated memory for the next batch
+      void clear()
+      {
+        nulls.clear();
+        booleans.clear();
+        integrals.clear();
+        floating_points.clear();
+        dates.clear();
+        date_times.clear();
+        offsets.assign(1, 0);
+        data.clear();
+      }
+    };
+
+    // A chunk of rows of a result, column by column (see bind_result_t::fetch_columns)
+    struct column_batch_t
+    {
+      size_t rows{0};
+      std::vector<result_column_t> columns;
+
+      void clear()
+      {
+        rows = 0;
+        for (auto& column : columns)
+        {
+          column.clear();
+        }
+      }
+    };
+  }  // namespace postgresql
+}  // namespace sqlpp
+
+#endif
@@ -29,55 +29,195 @@
 #define SQLPP_POSTGRESQL_CONNECTION_H
 
 #include <sqlpp11/connection.h>
+#include <sqlpp11/logic.h>
+#include <sqlpp11/postgresql/async_result.h>
 #include <sqlpp11/postgresql/bind_result.h>
 #include <sqlpp11/postgresql/connection_config.h>
+#include <sqlpp11/postgresql/copy.h>
+#include <sqlpp11/postgresql/metrics.h>
 #include <sqlpp11/postgresql/prepared_statement.h>
 #include <sqlpp11/postgresql/result.h>
+#include <sqlpp11/postgresql/type_oid.h>
+#include <sqlpp11/result.h>
 #include <sqlpp11/serialize.h>
 #include <sqlpp11/transaction.h>
+#include <sqlpp11/type_traits.h>
 
+#include <cstdio>
 #include <sstream>
+#include <string>
+#include <type_traits>
 
 struct pg_conn;
 typedef struct pg_conn PGconn;
 
 namespace sqlpp
 {
+  // Forward declaration
+  template <typename Container>
+  struct value_list_t;
+
   namespace postgresql
   {
     namespace detail
     {
       // Forward declaration
       struct connection_handle;
+
+      template <typename T>
+      struct is_memoizable;
+
+      template <typename Nodes>
+      struct are_memoizable;
+
+      template <>
+      struct are_memoizable<::sqlpp::detail::type_vector<>> : std::true_type
+      {
+      };
+
+      template <typename Node, typename... Nodes>
+      struct are_memoizable<::sqlpp::detail::type_vector<Node, Nodes...>>
+          : std::integral_constant<bool,
+                                   is_memoizable<Node>::value &&
+                                       are_memoizable<::sqlpp::detail::type_vector<Nodes...>>::value>
+      {
+      };
+
+      template <typename T, typename Enable = void>
+      struct are_nodes_memoizable : std::true_type
+      {
+      };
+
+      template <typename T>
+      struct are_nodes_memoizable<T, typename std::enable_if<std::is_class<typename T::_nodes>::value>::type>
+          : are_memoizable<typename T::_nodes>
+      {
+      };
+
+      template <typename T, typename Enable = void>
+      struct is_dynamic_clause : std::false_type
+      {
+      };
+
+      template <typename T>
+      struct is_dynamic_clause<T, typename std::enable_if<T::_is_dynamic::value>::type> : std::true_type
+      {
+      };
+
+      template <typename T>
+      struct is_value_list : std::false_type
+      {
+      };
+
+      template <typename Container>
+      struct is_value_list<::sqlpp::value_list_t<Container>> : std::true_type
+      {
+      };
+
+      // Whether the text of a statement only depends on its type, i.e. it contains neither literal values nor
+      // dynamic parts, see connection::prepare_memoized()
+      template <typename T>
+      struct is_memoizable
+          : std::integral_constant<bool,
+                                   !::sqlpp::is_wrapped_value_t<T>::value && !is_value_list<T>::value &&
+                                       !is_dynamic_clause<T>::value && are_nodes_memoizable<T>::value>
+      {
+      };
+
+      // Serialized statement, see connection::prepare_memoized()
+      struct statement_text_t
+      {
+        std::string sql;
+        size_t parameter_count;
+        std::vector<Oid> parameter_types;
+      };
     }
 
     // Forward declaration
     class connection;
+    class pipeline_t;
+    template <typename Shape, typename... Columns>
+    class batch_insert_t;
 
     // Context
     struct context_t
     {
-      context_t(const connection& db) : _db(db)
+      // Escapes straight into the statement when written to the context, see escape()
+      struct escaped_t
       {
-      }
+        const context_t& _context;
+        const std::string& _arg;
+
+        operator std::string() const;
+      };
+
+      // Borrows the serialization buffer of the connection, so consecutive statements reuse its capacity
+      context_t(const connection& db);
       context_t(const connection&&) = delete;
+      context_t(const context_t&) = delete;
+      context_t& operator=(const context_t&) = delete;
+      ~context_t();
+
+      context_t& operator<<(const std::string& t)
+      {
+        _buffer.append(t);
+        return *this;
+      }
+
+      context_t& operator<<(const char* t)
+      {
+        _buffer.append(t);
+        return *this;
+      }
+
+      context_t& operator<<(char t)
+      {
+        _buffer.push_back(t);
+        return *this;
+      }
+
+      context_t& operator<<(bool t)
+      {
+        _buffer.append(t ? "TRUE" : "FALSE");
+        return *this;
+      }
+
+      context_t& operator<<(const escaped_t& t);
 
       template <typename T>
-      std::ostream& operator<<(T t)
+      typename std::enable_if<std::is_integral<T>::value && (sizeof(T) > 1), context_t&>::type operator<<(T t)
       {
-        return _os << t;
+        char digits[24];
+        const int length = std::is_signed<T>::value
+                               ? std::snprintf(digits, sizeof(digits), "%lld", static_cast<long long>(t))
+                               : std::snprintf(digits, sizeof(digits), "%llu", static_cast<unsigned long long>(t));
+        _buffer.append(digits, static_cast<size_t>(length));
+        return *this;
       }
 
-      std::ostream& operator<<(bool t)
+      // Everything else, e.g. floating point values, is formatted by a stream that keeps its state like before
+      template <typename T>
+      typename std::enable_if<!std::is_integral<T>::value || (sizeof(T) == 1), context_t&>::type operator<<(const T& t)
       {
-        return _os << (t ? "TRUE" : "FALSE");
+        _stream.str(std::string{});
+        _stream << t;
+        _buffer.append(_stream.str());
+        return *this;
       }
 
-      std::string escape(const std::string& arg);
+      context_t& operator<<(std::ostream& (*manipulator)(std::ostream&))
+      {
+        return operator<<<std::ostream& (*)(std::ostream&)>(manipulator);
+      }
 
-      std::string str() const
+      escaped_t escape(const std::string& arg)
       {
-        return _os.str();
+        return {*this, arg};
+      }
+
+      const std::string& str() const
+      {
+        return _buffer;
       }
 
       size_t count() const
@@ -90,17 +230,74 @@ namespace sqlpp
         ++_count;
       }
 
+      // Starts the next statement, keeping the capacity of the buffer
+      void reset()
+      {
+        _buffer.clear();
+        _count = 1;
+      }
+
       const connection& _db;
-      std::ostringstream _os;
+      std::string _buffer;
+      std::ostringstream _stream;
       size_t _count{1};
     };
 
     // Connection
     class connection : public sqlpp::connection
     {
+      friend context_t;
+      friend pipeline_t;
+      template <typename Shape, typename... Columns>
+      friend class batch_insert_t;
+
     private:
       std::unique_ptr<detail::connection_handle> _handle;
       bool _transaction_active{false};
+      // Returned by the last context_t, see context_t::context_t
+      mutable std::string _context_buffer;
+      // Set within prepare_memoized() and run_memoized()
+      bool _memoize_statements{false};
+
+      struct memoize_guard
+      {
+        bool& _memoize;
+
+        memoize_guard(bool& memoize) : _memoize(memoize)
+        {
+          _memoize = true;
+        }
+        ~memoize_guard()
+        {
+          _memoize = false;
+        }
+      };
+
+      // Serialized once per statement type, only reached for statements that pass detail::is_memoizable
+      template <typename Statement>
+      const detail::statement_text_t& memoized_text(const Statement& s)
+      {
+        static const detail::statement_text_t text = [&]() -> detail::statement_text_t {
+          _context_t ctx(*this);
+          serialize(s, ctx);
+          return {ctx.str(), ctx.count() - 1, detail::parameter_oids<make_parameter_list_t<Statement>>::get()};
+        }();
+        return text;
+      }
+
+      template <typename Statement>
+      prepared_statement_t serialize_and_prepare(const Statement& s)
+      {
+        if (_memoize_statements)
+        {
+          const auto& text = memoized_text(s);
+          return prepare_impl(text.sql, text.parameter_count, text.parameter_types);
+        }
+        _context_t ctx(*this);
+        serialize(s, ctx);
+        return prepare_impl(ctx.str(), ctx.count() - 1,
+                            detail::parameter_oids<make_parameter_list_t<Statement>>::get());
+      }
 
       void validate_connection_handle() const
       {
@@ -115,13 +312,28 @@ namespace sqlpp
       size_t remove_impl(const std::string& stmt);
 
       // prepared execution
-      prepared_statement_t prepare_impl(const std::string& stmt, const size_t& paramCount);
+      prepared_statement_t prepare_impl(const std::string& stmt,
+                                        const size_t& paramCount,
+                                        const std::vector<Oid>& paramTypes);
       bind_result_t run_prepared_select_impl(prepared_statement_t& prep);
       size_t run_prepared_execute_impl(prepared_statement_t& prep);
       size_t run_prepared_insert_impl(prepared_statement_t& prep);
       size_t run_prepared_update_impl(prepared_statement_t& prep);
       size_t run_prepared_remove_impl(prepared_statement_t& prep);
 
+      // streaming execution
+      bind_result_t stream_impl(const std::string& stmt, int chunk_rows);
+      bind_result_t stream_prepared_impl(prepared_statement_t& prep, int chunk_rows);
+      bind_result_t cursor_impl(const std::string& stmt, int fetch_size);
+
+      // bulk load
+      copy_writer_t copy_in_impl(const std::string& table, const std::vector<std::string>& columns);
+      bind_result_t copy_out_impl(const std::string& stmt, int chunk_rows);
+
+      // asynchronous execution
+      async_result_t async_impl(const std::string& stmt);
+      async_result_t async_prepared_impl(prepared_statement_t& prep);
+
     public:
       using _prepared_statement_t = prepared_statement_t;
       using _context_t = context_t;
@@ -161,6 +373,10 @@ namespace sqlpp
       template <typename Select>
       bind_result_t select(const Select& s)
       {
+        if (_memoize_statements)
+        {
+          return select_impl(memoized_text(s).sql);
+        }
         _context_t ctx(*this);
         serialize(s, ctx);
         return select_impl(ctx.str());
@@ -170,9 +386,7 @@ namespace sqlpp
       template <typename Select>
       _prepared_statement_t prepare_select(Select& s)
       {
-        _context_t ctx(*this);
-        serialize(s, ctx);
-        return prepare_impl(ctx.str(), ctx.count() - 1);
+        return serialize_and_prepare(s);
       }
 
       template <typename PreparedSelect>
@@ -182,21 +396,98 @@ namespace sqlpp
         return run_prepared_select_impl(s._prepared_statement);
       }
 
+      // Streamed select: rows are handed out while they arrive instead of after the whole result was received, in
+      // single row mode or, with libpq 17 or later, in chunks of chunk_rows rows. Leaving the loop early cancels the
+      // rest of the query. The connection cannot run other statements until the result is exhausted or destroyed.
+      template <typename Select>
+      auto stream(const Select& s, int chunk_rows = 1)
+          -> ::sqlpp::result_t<bind_result_t, typename Select::template _result_row_t<connection>>
+      {
+        ::sqlpp::run_check_t<_serializer_context_t, Select>::verify();
+        _context_t ctx(*this);
+        serialize(s, ctx);
+        return {stream_impl(ctx.str(), chunk_rows), s.get_dynamic_names()};
+      }
+
+      template <typename PreparedSelect>
+      auto stream_prepared(const PreparedSelect& s, int chunk_rows = 1)
+          -> ::sqlpp::result_t<bind_result_t, typename PreparedSelect::_result_row_t>
+      {
+        s._bind_params();
+        return {stream_prepared_impl(s._prepared_statement, chunk_rows), s._dynamic_names};
+      }
+
+      // Select through a cursor declared in the current transaction: rows are fetched from the server in batches of
+      // fetch_size rows while iterating. Throws if no transaction is active.
+      template <typename Select>
+      auto cursor(const Select& s, int fetch_size = 1000)
+          -> ::sqlpp::result_t<bind_result_t, typename Select::template _result_row_t<connection>>
+      {
+        ::sqlpp::run_check_t<_serializer_context_t, Select>::verify();
+        _context_t ctx(*this);
+        serialize(s, ctx);
+        return {cursor_impl(ctx.str(), fetch_size), s.get_dynamic_names()};
+      }
+
+      // Bulk load with COPY ... FROM STDIN in the binary format, e.g.
+      //   auto copy = db.copy_in(tab, tab.alpha, tab.gamma);
+      //   copy.push(1, "one");
+      //   copy.push(2, sqlpp::null);
+      //   copy.finish();
+      // The connection cannot run other statements until finish() was called or the copy_in_t was destroyed.
+      template <typename Table, typename... Columns>
+      copy_in_t<Columns...> copy_in(const Table&, const Columns&...)
+      {
+        static_assert(::sqlpp::is_table_t<Table>::value, "copy_in() requires a table");
+        static_assert(sizeof...(Columns) > 0, "copy_in() requires at least one column");
+        static_assert(::sqlpp::logic::all_t<std::is_same<typename Columns::_table, Table>::value...>::value,
+                      "copy_in() requires columns of the given table");
+        return {copy_in_impl(::sqlpp::name_of<Table>::char_ptr(), {::sqlpp::name_of<Columns>::char_ptr()...})};
+      }
+
+      // Select with COPY (...) TO STDOUT in the binary format, rows are decoded while they arrive in chunks of
+      // chunk_rows rows. The connection cannot run other statements until the result is exhausted or destroyed.
+      template <typename Select>
+      auto copy_out(const Select& s, int chunk_rows = 1000)
+          -> ::sqlpp::result_t<bind_result_t, typename Select::template _result_row_t<connection>>
+      {
+        ::sqlpp::run_check_t<_serializer_context_t, Select>::verify();
+        _context_t ctx(*this);
+        serialize(s, ctx);
+        return {copy_out_impl(ctx.str(), chunk_rows), s.get_dynamic_names()};
+      }
+
       // Insert
       template <typename Insert>
       size_t insert(const Insert& i)
       {
+        if (_memoize_statements)
+        {
+          return insert_impl(memoized_text(i).sql);
+        }
         _context_t ctx(*this);
         serialize(i, ctx);
         return insert_impl(ctx.str());
       }
 
+      // Batched insert of ranges of rows into the given columns, e.g.
+      //   auto batch = db.batch_insert(sqlpp::postgresql::insert_into(tab).on_conflict(tab.alpha).do_nothing(),
+      //                                tab.alpha, tab.gamma);
+      //   batch.run(std::vector<std::tuple<int, std::string>>{{1, "one"}, {2, "two"}});
+      // The statement must not contain values or parameters of its own, on_conflict() and returning() are supported.
+      // A run() of more rows than fit one statement is not atomic unless it is part of a transaction.
+      // Requires <sqlpp11/postgresql/batch_insert.h>, which is part of <sqlpp11/postgresql/postgresql.h>.
+      template <typename Shape, typename... Columns>
+      batch_insert_t<Shape, Columns...> batch_insert(const Shape& shape, const Columns&...)
+      {
+        static_assert(sizeof...(Columns) > 0, "batch_insert() requires at least one column");
+        return {*this, shape};
+      }
+
       template <typename Insert>
       prepared_statement_t prepare_insert(Insert& i)
       {
-        _context_t ctx(*this);
-        serialize(i, ctx);
-        return prepare_impl(ctx.str(), ctx.count() - 1);
+        return serialize_and_prepare(i);
       }
 
       template <typename PreparedInsert>
@@ -210,6 +501,10 @@ namespace sqlpp
       template <typename Update>
       size_t update(const Update& u)
       {
+        if (_memoize_statements)
+        {
+          return update_impl(memoized_text(u).sql);
+        }
         _context_t ctx(*this);
         serialize(u, ctx);
         return update_impl(ctx.str());
@@ -218,9 +513,7 @@ namespace sqlpp
       template <typename Update>
       prepared_statement_t prepare_update(Update& u)
       {
-        _context_t ctx(*this);
-        serialize(u, ctx);
-        return prepare_impl(ctx.str(), ctx.count() - 1);
+        return serialize_and_prepare(u);
       }
 
       template <typename PreparedUpdate>
@@ -234,6 +527,10 @@ namespace sqlpp
       template <typename Remove>
       size_t remove(const Remove& r)
       {
+        if (_memoize_statements)
+        {
+          return remove_impl(memoized_text(r).sql);
+        }
         _context_t ctx(*this);
         serialize(r, ctx);
         return remove_impl(ctx.str());
@@ -242,9 +539,7 @@ namespace sqlpp
       template <typename Remove>
       prepared_statement_t prepare_remove(Remove& r)
       {
-        _context_t ctx(*this);
-        serialize(r, ctx);
-        return prepare_impl(ctx.str(), ctx.count() - 1);
+        return serialize_and_prepare(r);
       }
 
       template <typename PreparedRemove>
@@ -270,9 +565,7 @@ namespace sqlpp
       template <typename Execute>
       _prepared_statement_t prepare_execute(Execute& x)
       {
-        _context_t ctx(*this);
-        serialize(x, ctx);
-        return prepare_impl(ctx.str(), ctx.count() - 1);
+        return serialize_and_prepare(x);
       }
 
       template <typename PreparedExecute>
@@ -283,8 +576,76 @@ namespace sqlpp
         return run_prepared_execute_impl(x._prepared_statement);
       }
 
+      // Asynchronous execution: the statement is sent without waiting for the result, the returned handle exposes the
+      // socket of the connection for an event loop and resolves to the result or the number of affected rows. The
+      // connection cannot run other statements until the result arrived or the handle was destroyed.
+      template <typename Select>
+      auto async_select(const Select& s)
+          -> async_select_t<typename Select::template _result_row_t<connection>, decltype(s.get_dynamic_names())>
+      {
+        ::sqlpp::run_check_t<_serializer_context_t, Select>::verify();
+        _context_t ctx(*this);
+        serialize(s, ctx);
+        return {async_impl(ctx.str()), s.get_dynamic_names()};
+      }
+
+      template <typename Insert>
+      async_result_t async_insert(const Insert& i)
+      {
+        _context_t ctx(*this);
+        serialize(i, ctx);
+        return async_impl(ctx.str());
+      }
+
+      template <typename Update>
+      async_result_t async_update(const Update& u)
+      {
+        _context_t ctx(*this);
+        serialize(u, ctx);
+        return async_impl(ctx.str());
+      }
+
+      template <typename Remove>
+      async_result_t async_remove(const Remove& r)
+      {
+        _context_t ctx(*this);
+        serialize(r, ctx);
+        return async_impl(ctx.str());
+      }
+
+      template <typename PreparedSelect>
+      auto async_run_prepared_select(const PreparedSelect& s)
+          -> async_select_t<typename PreparedSelect::_result_row_t, decltype(s._dynamic_names)>
+      {
+        s._bind_params();
+        return {async_prepared_impl(s._prepared_statement), s._dynamic_names};
+      }
+
+      template <typename PreparedInsert>
+      async_result_t async_run_prepared_insert(const PreparedInsert& i)
+      {
+        i._bind_params();
+        return async_prepared_impl(i._prepared_statement);
+      }
+
+      template <typename PreparedUpdate>
+      async_result_t async_run_prepared_update(const PreparedUpdate& u)
+      {
+        u._bind_params();
+        return async_prepared_impl(u._prepared_statement);
+      }
+
+      template <typename PreparedRemove>
+      async_result_t async_run_prepared_remove(const PreparedRemove& r)
+      {
+        r._bind_params();
+        return async_prepared_impl(r._prepared_statement);
+      }
+
       // escape argument
       std::string escape(const std::string& s) const;
+      // escape argument, appending it to target
+      void escape(const std::string& s, std::string& target) const;
 
       //! call run on the argument
       template <typename T>
@@ -318,6 +679,27 @@ namespace sqlpp
         return _prepare(t, sqlpp::prepare_check_t<_serializer_context_t, T>{});
       }
 
+      //! Like prepare() and operator(), but the statement is serialized only once per statement type and the text is
+      // reused afterwards, by all connections. Only for statements with a fixed text: values must be passed with
+      // parameter(), statements with literal values or dynamic parts do not compile.
+      template <typename T>
+      auto prepare_memoized(const T& t) -> decltype(this->prepare(t))
+      {
+        static_assert(detail::is_memoizable<T>::value,
+                      "prepare_memoized() takes parameters only, no inline literals and no dynamic parts");
+        const memoize_guard guard(_memoize_statements);
+        return prepare(t);
+      }
+
+      template <typename T>
+      auto run_memoized(const T& t) -> decltype((*this)(t))
+      {
+        static_assert(detail::is_memoizable<T>::value,
+                      "run_memoized() takes parameters only, no inline literals and no dynamic parts");
+        const memoize_guard guard(_memoize_statements);
+        return (*this)(t);
+      }
+
       //! set the default transaction isolation level to use for new transactions
       void set_default_isolation_level(isolation_level level);
 
@@ -350,11 +732,35 @@ namespace sqlpp
       uint64_t last_insert_id(const std::string& table, const std::string& fieldname);
 
       ::PGconn* native_handle();
+
+      //! Metrics of the statements run so far, empty unless connection_config::metrics is set. May be called from
+      // other threads while the connection is in use, e.g. by a monitoring thread merging the snapshots of a pool.
+      metrics_snapshot_t metrics() const;
     };
 
-    inline std::string context_t::escape(const std::string& arg)
+    inline context_t::context_t(const connection& db) : _db(db)
+    {
+      _buffer.swap(db._context_buffer);
+      _buffer.clear();
+    }
+
+    inline context_t::~context_t()
+    {
+      if (_buffer.capacity() > _db._context_buffer.capacity())
+      {
+        _buffer.swap(_db._context_buffer);
+      }
+    }
+
+    inline context_t& context_t::operator<<(const escaped_t& t)
+    {
+      _db.escape(t._arg, _buffer);
+      return *this;
+    }
+
+    inline context_t::escaped_t::operator std::string() const
     {
-      return _db.escape(arg);
+      return _context._db.escape(_arg);
     }
   }
 }
@@ -28,7 +28,10 @@
 #ifndef SQLPP_POSTGRESQL_CONNECTION_CONFIG_H
 #define SQLPP_POSTGRESQL_CONNECTION_CONFIG_H
 
+#include <sqlpp11/postgresql/tracer.h>
 #include <sqlpp11/postgresql/visibility.h>
+#include <cstddef>
+#include <memory>
 #include <string>
 
 namespace sqlpp
@@ -76,6 +79,32 @@ namespace sqlpp
       std::string service;
       // bool auto_reconnect {true};
       bool debug{false};
+      // Request the results of prepared statements in the binary format instead of text. Saves the parsing of
+      // numbers, dates and timestamps on the client. Timestamps with time zone are returned as UTC instead of the
+      // session time zone. Besides the types sqlpp11 knows, only uuid values are converted back to text, so
+      // columns of other types should be cast to text in the query when this is enabled.
+      bool binary_results{false};
+      // Send boolean, integral, floating point, date and timestamp parameters of prepared statements in the binary
+      // format, typed as bool, int8, float8, date and timestamptz. Timestamps are sent as UTC, not as local time.
+      bool binary_parameters{false};
+      // Send timestamp parameters in the text format as UTC instead of local time, without looking up the local
+      // time zone. Results of timestamps with time zone still follow the session time zone (SET TIME ZONE 'UTC').
+      bool utc_timestamps{false};
+      // Amount of data collected before it is sent to the server during a COPY (see connection::copy_in)
+      std::size_t copy_buffer_size{64 * 1024};
+      // Number of prepared statements kept per connection for reuse. Preparing a statement with the same text and
+      // parameter types as a cached statement that is no longer in use skips the PREPARE and DEALLOCATE round trips,
+      // the least recently used statements are deallocated when the cache is full. 0 disables the cache.
+      std::size_t statement_cache_size{0};
+      // Released prepared statements are deallocated together, in one round trip before the next statement once this
+      // many are pending, instead of one DEALLOCATE each when they are destroyed
+      std::size_t deallocate_batch_size{16};
+      // Receives the start, end and errors of the statements of the connection, e.g. for timing them in production.
+      // Unlike debug there is no cost without a tracer. Shared by the connections with this configuration.
+      std::shared_ptr<tracer_t> tracer;
+      // Collects latency histograms, row and byte counts and errors per statement fingerprint, see
+      // connection::metrics()
+      bool metrics{false};
 
       bool operator==(const connection_config& other)
       {
@@ -87,7 +116,12 @@ namespace sqlpp
                 other.keepalives_count == keepalives_count && other.sslmode == sslmode &&
                 other.sslcompression == sslcompression && other.sslcert == sslcert && other.sslkey == sslkey &&
                 other.sslrootcert == sslrootcert && other.sslcrl == sslcrl && other.requirepeer == requirepeer &&
-                other.krbsrvname == krbsrvname && other.service == service && other.debug == debug);
+                other.krbsrvname == krbsrvname && other.service == service && other.debug == debug &&
+                other.binary_results == binary_results && other.binary_parameters == binary_parameters &&
+                other.utc_timestamps == utc_timestamps && other.copy_buffer_size == copy_buffer_size &&
+                other.statement_cache_size == statement_cache_size &&
+                other.deallocate_batch_size == deallocate_batch_size && other.tracer == tracer &&
+                other.metrics == metrics);
       }
       bool operator!=(const connection_config& other)
       {
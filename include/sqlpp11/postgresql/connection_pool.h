@@ -0,0 +1,118 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_POSTGRESQL_CONNECTION_POOL_H
+#define SQLPP_POSTGRESQL_CONNECTION_POOL_H
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+
+#include <sqlpp11/postgresql/connection.h>
+#include <sqlpp11/postgresql/connection_config.h>
+#include <sqlpp11/postgresql/visibility.h>
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+    namespace detail
+    {
+      struct connection_pool_state_t;
+    }
+
+    // A connection taken from a connection_pool, it goes back to the pool when destroyed. Connections that are
+    // broken, still in a transaction or busy with a result are closed instead.
+    class DLL_PUBLIC pooled_connection_t
+    {
+    private:
+      std::shared_ptr<detail::connection_pool_state_t> _pool;
+      std::unique_ptr<connection> _connection;
+      bool _reusable{true};
+
+    public:
+      pooled_connection_t(const std::shared_ptr<detail::connection_pool_state_t>& pool,
+                          std::unique_ptr<connection>&& connection);
+      pooled_connection_t(const pooled_connection_t&) = delete;
+      pooled_connection_t(pooled_connection_t&&) = default;
+      pooled_connection_t& operator=(const pooled_connection_t&) = delete;
+      pooled_connection_t& operator=(pooled_connection_t&&) = delete;
+      ~pooled_connection_t();
+
+      connection& operator*()
+      {
+        return *_connection;
+      }
+
+      connection* operator->()
+      {
+        return _connection.get();
+      }
+
+      // Closes the connection when it is released instead of returning it to the pool
+      void invalidate()
+      {
+        _reusable = false;
+      }
+    };
+
+    // Thread safe pool of at most max_connections connections. Idle connections are kept in shards with their own
+    // lock, and each thread returns and takes connections from its own shard first, so threads mostly get back the
+    // connection they used last without contending with each other. Connections that were idle for longer than
+    // max_idle are closed when the pool is used (there is no background thread).
+    class DLL_PUBLIC connection_pool
+    {
+    private:
+      std::shared_ptr<detail::connection_pool_state_t> _state;
+
+    public:
+      connection_pool(const std::shared_ptr<connection_config>& config,
+                      std::size_t max_connections,
+                      std::chrono::milliseconds max_idle = std::chrono::minutes(5));
+      connection_pool(const connection_pool&) = delete;
+      connection_pool(connection_pool&&) = default;
+      connection_pool& operator=(const connection_pool&) = delete;
+      connection_pool& operator=(connection_pool&&) = default;
+      ~connection_pool() = default;
+
+      // Takes an idle connection or opens a new one. If max_connections are in use, waits up to timeout for one to be
+      // released and throws sqlpp::exception after that.
+      pooled_connection_t get(std::chrono::milliseconds timeout = std::chrono::seconds(30));
+
+      // Number of open connections, in use or idle
+      std::size_t size() const;
+
+      // Number of idle connections
+      std::size_t idle() const;
+
+      // Closes the connections that were idle for longer than max_idle
+      void reap_idle();
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,160 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_POSTGRESQL_COPY_H
+#define SQLPP_POSTGRESQL_COPY_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <sqlpp11/chrono.h>
+#include <sqlpp11/data_types.h>
+#include <sqlpp11/null.h>
+#include <sqlpp11/postgresql/type_oid.h>
+#include <sqlpp11/postgresql/visibility.h>
+#include <sqlpp11/type_traits.h>
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+    namespace detail
+    {
+      struct connection_handle;
+      class deferred_trace_t;
+    }
+
+    // Encodes rows in the binary COPY format and sends them to the server in batches of
+    // connection_config::copy_buffer_size bytes. Destroying it before finish() aborts the COPY.
+    class DLL_PUBLIC copy_writer_t
+    {
+    private:
+      detail::connection_handle* _connection{nullptr};
+      std::vector<Oid> _types;
+      std::string _buffer;
+      size_t _bufferSize{0};
+      // Where the row being pushed starts in _buffer
+      size_t _rowStart{0};
+      bool _active{false};
+      // From starting the COPY to its completion
+      std::unique_ptr<detail::deferred_trace_t> _trace;
+
+      void flush();
+      void abort() noexcept;
+      [[noreturn]] void throw_type_error(size_t index, const char* value_type) const;
+
+    public:
+      copy_writer_t(detail::connection_handle& connection, const std::string& command, std::vector<Oid> types);
+      copy_writer_t(const copy_writer_t&) = delete;
+      copy_writer_t(copy_writer_t&& other);
+      copy_writer_t& operator=(const copy_writer_t&) = delete;
+      copy_writer_t& operator=(copy_writer_t&& other);
+      ~copy_writer_t();
+
+      // Sends the rest of the rows and ends the COPY, returns the number of rows copied
+      size_t finish();
+
+      void _begin_row();
+      // Drops the fields of a row that failed to bind, so that the stream stays valid
+      void _discard_row();
+      void _bind_null(size_t index);
+      void _bind_boolean_parameter(size_t index, const signed char* value, bool is_null);
+      void _bind_floating_point_parameter(size_t index, const double* value, bool is_null);
+      void _bind_integral_parameter(size_t index, const int64_t* value, bool is_null);
+      void _bind_text_parameter(size_t index, const std::string* value, bool is_null);
+      void _bind_date_parameter(size_t index, const ::sqlpp::chrono::day_point* value, bool is_null);
+      void _bind_date_time_parameter(size_t index, const ::sqlpp::chrono::microsecond_point* value, bool is_null);
+    };
+
+    // Bulk load into the given columns of a table with COPY ... FROM STDIN (see connection::copy_in). Each row takes
+    // one value (or sqlpp::null) per column, in the order of the columns.
+    template <typename... Columns>
+    class copy_in_t
+    {
+    private:
+      copy_writer_t _writer;
+
+      template <size_t Index>
+      void _push()
+      {
+      }
+
+      template <size_t Index, typename Value, typename... Rest>
+      void _push(const Value& value, const Rest&... rest)
+      {
+        using _column_t = typename std::tuple_element<Index, std::tuple<Columns...>>::type;
+        _write<::sqlpp::value_type_of<_column_t>>(Index, value);
+        _push<Index + 1>(rest...);
+      }
+
+      template <typename ValueType, typename Value>
+      void _write(size_t index, const Value& value)
+      {
+        ::sqlpp::parameter_value_t<ValueType> parameter;
+        parameter = value;
+        parameter._bind(_writer, index);
+      }
+
+      template <typename ValueType>
+      void _write(size_t index, const ::sqlpp::null_t&)
+      {
+        _writer._bind_null(index);
+      }
+
+    public:
+      copy_in_t(copy_writer_t&& writer) : _writer(std::move(writer))
+      {
+      }
+
+      template <typename... Values>
+      void push(const Values&... values)
+      {
+        static_assert(sizeof...(Values) == sizeof...(Columns), "copy_in: push() requires one value per column");
+        _writer._begin_row();
+        try
+        {
+          _push<0>(values...);
+        }
+        catch (...)
+        {
+          _writer._discard_row();
+          throw;
+        }
+      }
+
+      size_t finish()
+      {
+        return _writer.finish();
+      }
+    };
+  }
+}
+
+#endif
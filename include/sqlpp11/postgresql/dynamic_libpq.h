@@ -133,6 +133,7 @@ DYNDEFINE(PQgetisnull);
 DYNDEFINE(PQoidValue);
 DYNDEFINE(PQoidStatus);
 DYNDEFINE(PQfformat);
+DYNDEFINE(PQftype);
 DYNDEFINE(PQntuples);
 DYNDEFINE(PQnfields);
 DYNDEFINE(PQnparams);
@@ -141,6 +142,43 @@ DYNDEFINE(PQfinish);
 DYNDEFINE(PQstatus);
 DYNDEFINE(PQconnectdb);
 DYNDEFINE(PQerrorMessage);
+DYNDEFINE(PQsendQuery);
+DYNDEFINE(PQsendQueryPrepared);
+DYNDEFINE(PQsetSingleRowMode);
+DYNDEFINE(PQgetResult);
+DYNDEFINE(PQgetCancel);
+DYNDEFINE(PQcancel);
+DYNDEFINE(PQfreeCancel);
+#ifdef LIBPQ_HAS_CHUNK_MODE
+DYNDEFINE(PQsetChunkedRowsMode);
+#endif
+DYNDEFINE(PQtransactionStatus);
+DYNDEFINE(PQputCopyData);
+DYNDEFINE(PQputCopyEnd);
+DYNDEFINE(PQgetCopyData);
+DYNDEFINE(PQdescribePrepared);
+DYNDEFINE(PQfname);
+DYNDEFINE(PQmakeEmptyPGresult);
+DYNDEFINE(PQsetResultAttrs);
+DYNDEFINE(PQsetvalue);
+DYNDEFINE(PQsendQueryParams);
+#ifdef LIBPQ_HAS_PIPELINING
+DYNDEFINE(PQenterPipelineMode);
+DYNDEFINE(PQexitPipelineMode);
+DYNDEFINE(PQpipelineSync);
+DYNDEFINE(PQpipelineStatus);
+#endif
+DYNDEFINE(PQsetnonblocking);
+DYNDEFINE(PQisnonblocking);
+DYNDEFINE(PQsocket);
+DYNDEFINE(PQconsumeInput);
+DYNDEFINE(PQisBusy);
+DYNDEFINE(PQflush);
+#ifdef SQLPP_POSTGRESQL_HAS_RESULT_MEMORY_SIZE
+DYNDEFINE(PQresultMemorySize);
+#endif
+DYNDEFINE(PQnotifies);
+DYNDEFINE(PQescapeIdentifier);
 
 #undef DYNDEFINE
 
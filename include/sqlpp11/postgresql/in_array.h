@@ -0,0 +1,116 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_POSTGRESQL_IN_ARRAY_H
+#define SQLPP_POSTGRESQL_IN_ARRAY_H
+
+#include <sqlpp11/alias_operators.h>
+#include <sqlpp11/data_types/array.h>
+#include <sqlpp11/data_types/boolean.h>
+#include <sqlpp11/parameter.h>
+#include <sqlpp11/serializer.h>
+#include <sqlpp11/type_traits.h>
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+    template <bool NotIn, typename Operand, typename Parameter>
+    struct in_array_t : public expression_operators<in_array_t<NotIn, Operand, Parameter>, boolean>,
+                        public alias_operators<in_array_t<NotIn, Operand, Parameter>>
+    {
+      using _traits = make_traits<boolean, tag::is_expression, tag::is_selectable>;
+      using _nodes = sqlpp::detail::type_vector<Operand, Parameter>;
+
+      in_array_t(Operand operand, Parameter parameter) : _operand(operand), _parameter(parameter)
+      {
+      }
+
+      in_array_t(const in_array_t&) = default;
+      in_array_t(in_array_t&&) = default;
+      in_array_t& operator=(const in_array_t&) = default;
+      in_array_t& operator=(in_array_t&&) = default;
+      ~in_array_t() = default;
+
+      Operand _operand;
+      Parameter _parameter;
+    };
+
+    template <typename Expression, typename NameType>
+    using array_parameter_t = parameter_t<::sqlpp::array<value_type_of<Expression>>, NameType>;
+
+    // column.in(values) with a statement text that does not depend on the number of values, column = ANY($n). The
+    // values are bound to an array parameter named after the column (or the given alias), e.g.
+    //   auto prepared = db.prepare(select(tab.gamma).from(tab).where(sqlpp::postgresql::in_array(tab.alpha)));
+    //   prepared.params.alpha = std::vector<int64_t>{1, 2, 3};
+    template <typename Column>
+    auto in_array(const Column& column) -> in_array_t<false, Column, array_parameter_t<Column, Column>>
+    {
+      return {column, array_parameter_t<Column, Column>{}};
+    }
+
+    template <typename Expression, typename AliasProvider>
+    auto in_array(const Expression& expression, const AliasProvider&)
+        -> in_array_t<false, Expression, array_parameter_t<Expression, AliasProvider>>
+    {
+      return {expression, array_parameter_t<Expression, AliasProvider>{}};
+    }
+
+    // column.not_in(values) as column <> ALL($n), see in_array()
+    template <typename Column>
+    auto not_in_array(const Column& column) -> in_array_t<true, Column, array_parameter_t<Column, Column>>
+    {
+      return {column, array_parameter_t<Column, Column>{}};
+    }
+
+    template <typename Expression, typename AliasProvider>
+    auto not_in_array(const Expression& expression, const AliasProvider&)
+        -> in_array_t<true, Expression, array_parameter_t<Expression, AliasProvider>>
+    {
+      return {expression, array_parameter_t<Expression, AliasProvider>{}};
+    }
+  }
+
+  template <typename Context, bool NotIn, typename Operand, typename Parameter>
+  struct serializer_t<Context, postgresql::in_array_t<NotIn, Operand, Parameter>>
+  {
+    using _serialize_check = serialize_check_of<Context, Operand, Parameter>;
+    using T = postgresql::in_array_t<NotIn, Operand, Parameter>;
+
+    static Context& _(const T& t, Context& context)
+    {
+      context << '(';
+      serialize(t._operand, context);
+      context << (NotIn ? " <> ALL(" : " = ANY(");
+      serialize(t._parameter, context);
+      context << "))";
+      return context;
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,140 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_POSTGRESQL_METRICS_H
+#define SQLPP_POSTGRESQL_METRICS_H
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+    // Latencies in buckets of powers of two microseconds: bucket 0 counts everything below 2us, bucket i the
+    // durations from 2^i up to 2^(i + 1) microseconds, the last bucket everything longer
+    struct latency_histogram_t
+    {
+      static constexpr std::size_t bucket_count = 32;
+
+      std::array<uint64_t, bucket_count> buckets{};
+      uint64_t count{0};
+      std::chrono::nanoseconds total{0};
+
+      static std::size_t bucket_of(std::chrono::nanoseconds duration)
+      {
+        auto microseconds = static_cast<uint64_t>(duration.count() / 1000) >> 1;
+        std::size_t bucket = 0;
+        while (microseconds && bucket < bucket_count - 1)
+        {
+          microseconds >>= 1;
+          ++bucket;
+        }
+        return bucket;
+      }
+
+      // Upper bound of the bucket that contains the given percentile (0 to 100), e.g. percentile(99)
+      std::chrono::microseconds percentile(double p) const
+      {
+        const auto rank = static_cast<uint64_t>(p / 100 * static_cast<double>(count));
+        uint64_t seen = 0;
+        for (std::size_t bucket = 0; bucket < bucket_count; ++bucket)
+        {
+          seen += buckets[bucket];
+          if (seen > rank || seen == count)
+          {
+            return std::chrono::microseconds{int64_t{2} << bucket};
+          }
+        }
+        return std::chrono::microseconds{0};
+      }
+
+      void merge(const latency_histogram_t& other)
+      {
+        for (std::size_t bucket = 0; bucket < bucket_count; ++bucket)
+        {
+          buckets[bucket] += other.buckets[bucket];
+        }
+        count += other.count;
+        total += other.total;
+      }
+    };
+
+    // What is known about one statement. Statements are identified by their fingerprint: the text with literals
+    // replaced by ?, lists of them collapsed to one and whitespace normalized, so that "a IN (1, 2)" and "a IN (3)"
+    // count as the same statement.
+    struct statement_metrics_t
+    {
+      latency_histogram_t prepare;
+      // Direct execution, execution of prepared statements and cursor declarations
+      latency_histogram_t execute;
+      // Cursor fetches
+      latency_histogram_t fetch;
+      uint64_t rows{0};
+      uint64_t affected_rows{0};
+      // Memory of the results, as reported by PQresultMemorySize. Not counted with libpq older than 12.
+      uint64_t result_bytes{0};
+      // Failures by SQLSTATE class, e.g. "23" for integrity constraint violations, "" if there was no result at all
+      std::map<std::string, uint64_t> errors;
+
+      void merge(const statement_metrics_t& other)
+      {
+        prepare.merge(other.prepare);
+        execute.merge(other.execute);
+        fetch.merge(other.fetch);
+        rows += other.rows;
+        affected_rows += other.affected_rows;
+        result_bytes += other.result_bytes;
+        for (const auto& error : other.errors)
+        {
+          errors[error.first] += error.second;
+        }
+      }
+    };
+
+    // The metrics of a connection at one point in time, keyed by statement fingerprint (see
+    // connection_config::metrics). Snapshots of several connections can be merged.
+    struct metrics_snapshot_t
+    {
+      std::map<std::string, statement_metrics_t> statements;
+
+      void merge(const metrics_snapshot_t& other)
+      {
+        for (const auto& statement : other.statements)
+        {
+          statements[statement.first].merge(statement.second);
+        }
+      }
+    };
+  }  // namespace postgresql
+}  // namespace sqlpp
+
+#endif
@@ -0,0 +1,99 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_POSTGRESQL_NOTIFICATION_LISTENER_H
+#define SQLPP_POSTGRESQL_NOTIFICATION_LISTENER_H
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <sqlpp11/postgresql/visibility.h>
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+    // Forward declaration
+    class connection;
+
+    struct notification_t
+    {
+      std::string channel;
+      std::string payload;
+      // Process ID of the server backend of the notifying session
+      int backend_pid;
+    };
+
+    // Subscribes a connection to channels with LISTEN and receives their notifications, e.g. for invalidating caches:
+    //   sqlpp::postgresql::notification_listener_t listener(db, {"cache"});
+    //   for (;;)
+    //     for (const auto& notification : listener.wait())
+    //       invalidate(notification.payload);
+    // Waiting blocks on the socket of the connection instead of polling the server, each wakeup returns all the
+    // notifications that arrived by then in one batch. The connection can run other statements in between, the
+    // notifications received meanwhile are returned by the next call. The server only delivers notifications of
+    // committed transactions, and only while this connection is not inside a transaction itself.
+    class DLL_PUBLIC notification_listener_t
+    {
+      connection& _db;
+      std::vector<std::string> _channels;
+
+      std::vector<notification_t> wait_for(int timeout_ms);
+
+    public:
+      notification_listener_t(connection& db, const std::vector<std::string>& channels = {});
+      notification_listener_t(const notification_listener_t&) = delete;
+      notification_listener_t& operator=(const notification_listener_t&) = delete;
+      // Stops listening on the channels of this listener
+      ~notification_listener_t();
+
+      void listen(const std::string& channel);
+      void unlisten(const std::string& channel);
+
+      const std::vector<std::string>& channels() const
+      {
+        return _channels;
+      }
+
+      // Socket of the connection, to wait for readability in an event loop and then call poll(). -1 if the connection
+      // is broken.
+      int socket() const;
+
+      // The notifications that arrived so far, without blocking
+      std::vector<notification_t> poll();
+
+      // Blocks until there are notifications, throws if the connection is lost
+      std::vector<notification_t> wait();
+
+      // Blocks until there are notifications or the timeout expired, empty after a timeout
+      std::vector<notification_t> wait(std::chrono::milliseconds timeout);
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,155 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_POSTGRESQL_PIPELINE_H
+#define SQLPP_POSTGRESQL_PIPELINE_H
+
+#include <memory>
+#include <string>
+
+#include <sqlpp11/postgresql/bind_result.h>
+#include <sqlpp11/postgresql/connection.h>
+#include <sqlpp11/postgresql/visibility.h>
+#include <sqlpp11/result.h>
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+    namespace detail
+    {
+      struct pipeline_handle_t;
+      struct pipeline_state_t;
+    }
+
+    // Result of a statement sent in a pipeline. Accessing it waits for the results of the pipeline up to this
+    // statement, errors of the statement are thrown here.
+    class DLL_PUBLIC pipeline_entry_t
+    {
+    protected:
+      std::shared_ptr<detail::pipeline_state_t> _state;
+      std::shared_ptr<detail::pipeline_handle_t> _handle;
+
+      void _wait();
+      bind_result_t _bind_result();
+
+    public:
+      pipeline_entry_t(const std::shared_ptr<detail::pipeline_state_t>& state,
+                       const std::shared_ptr<detail::pipeline_handle_t>& handle);
+
+      size_t affected_rows();
+    };
+
+    template <typename ResultRow, typename DynamicNames>
+    class pipeline_select_t : public pipeline_entry_t
+    {
+    private:
+      DynamicNames _dynamic_names;
+
+    public:
+      pipeline_select_t(pipeline_entry_t&& entry, const DynamicNames& dynamic_names)
+          : pipeline_entry_t(std::move(entry)), _dynamic_names(dynamic_names)
+      {
+      }
+
+      ::sqlpp::result_t<bind_result_t, ResultRow> get()
+      {
+        return {_bind_result(), _dynamic_names};
+      }
+    };
+
+    // Sends statements without waiting for the results of the previous ones (libpq pipeline mode, libpq 14 or
+    // later). Results are read in order when an entry is accessed, sync() or finish() is called, or the pipeline is
+    // destroyed. The connection cannot run other statements while the pipeline exists.
+    //
+    //   sqlpp::postgresql::pipeline_t pipeline(db);
+    //   auto inserted = pipeline.execute(insert_into(tab).set(tab.gamma = "a"));
+    //   auto rows = pipeline.select(select(all_of(tab)).from(tab).unconditionally());
+    //   for (const auto& row : rows.get()) ...
+    //   inserted.affected_rows();
+    class DLL_PUBLIC pipeline_t
+    {
+    private:
+      connection& _db;
+      std::shared_ptr<detail::pipeline_state_t> _state;
+
+      pipeline_entry_t send_impl(const std::string& stmt);
+      pipeline_entry_t send_prepared_impl(prepared_statement_t& prep);
+
+    public:
+      pipeline_t(connection& db);
+      pipeline_t(const pipeline_t&) = delete;
+      pipeline_t(pipeline_t&&) = default;
+      pipeline_t& operator=(const pipeline_t&) = delete;
+      pipeline_t& operator=(pipeline_t&&) = delete;
+      ~pipeline_t();
+
+      // Insert, update, remove or any other statement without result rows
+      template <typename Statement>
+      pipeline_entry_t execute(const Statement& s)
+      {
+        connection::_context_t ctx(_db);
+        serialize(s, ctx);
+        return send_impl(ctx.str());
+      }
+
+      template <typename Select>
+      auto select(const Select& s)
+          -> pipeline_select_t<typename Select::template _result_row_t<connection>, decltype(s.get_dynamic_names())>
+      {
+        ::sqlpp::run_check_t<connection::_serializer_context_t, Select>::verify();
+        connection::_context_t ctx(_db);
+        serialize(s, ctx);
+        return {send_impl(ctx.str()), s.get_dynamic_names()};
+      }
+
+      // Prepared insert, update, remove or execute
+      template <typename Prepared>
+      pipeline_entry_t run_prepared(const Prepared& p)
+      {
+        p._bind_params();
+        return send_prepared_impl(p._prepared_statement);
+      }
+
+      template <typename PreparedSelect>
+      auto run_prepared_select(const PreparedSelect& p)
+          -> pipeline_select_t<typename PreparedSelect::_result_row_t, decltype(p._dynamic_names)>
+      {
+        p._bind_params();
+        return {send_prepared_impl(p._prepared_statement), p._dynamic_names};
+      }
+
+      // Asks the server to process everything sent so far, without waiting for it
+      void sync();
+
+      // Reads all outstanding results and leaves pipeline mode
+      void finish();
+    };
+  }
+}
+
+#endif
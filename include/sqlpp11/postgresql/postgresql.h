@@ -28,9 +28,14 @@
 #ifndef SQLPP_POSTGRESQL_H
 #define SQLPP_POSTGRESQL_H
 
+#include <sqlpp11/postgresql/batch_insert.h>
 #include <sqlpp11/postgresql/connection.h>
+#include <sqlpp11/postgresql/connection_pool.h>
 #include <sqlpp11/postgresql/exception.h>
+#include <sqlpp11/postgresql/in_array.h>
 #include <sqlpp11/postgresql/insert.h>
+#include <sqlpp11/postgresql/notification_listener.h>
+#include <sqlpp11/postgresql/pipeline.h>
 #include <sqlpp11/postgresql/update.h>
 
 #endif
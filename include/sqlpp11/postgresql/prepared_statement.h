@@ -30,6 +30,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 #include <sqlpp11/chrono.h>
 
 namespace sqlpp
@@ -38,6 +39,7 @@ namespace sqlpp
   {
     // Forward declaration
     class connection;
+    class pipeline_t;
 
     // Detail namespace
     namespace detail
@@ -48,6 +50,7 @@ namespace sqlpp
     class prepared_statement_t
     {
       friend sqlpp::postgresql::connection;
+      friend sqlpp::postgresql::pipeline_t;
 
     private:
       std::shared_ptr<detail::prepared_statement_handle_t> _handle;
@@ -72,6 +75,15 @@ namespace sqlpp
       void _bind_text_parameter(size_t index, const std::string* value, bool is_null);
       void _bind_date_parameter(size_t index, const ::sqlpp::chrono::day_point* value, bool is_null);
       void _bind_date_time_parameter(size_t index, const ::sqlpp::chrono::microsecond_point* value, bool is_null);
+
+      // One dimensional arrays, e.g. for column = ANY($1) (see in_array)
+      void _bind_array_parameter(size_t index, const std::vector<int64_t>* value, bool is_null);
+      void _bind_array_parameter(size_t index, const std::vector<std::string>* value, bool is_null);
+      void _bind_array_parameter(size_t index,
+                                 const std::vector<::sqlpp::chrono::microsecond_point>* value,
+                                 bool is_null);
+      // The uuids are given as their 16 bytes, one after the other
+      void _bind_uuid_array_parameter(size_t index, const std::string* value, bool is_null);
     };
   }
 }
@@ -28,9 +28,13 @@
 #ifndef SQLPP_POSTGRESQL_RESULT_H
 #define SQLPP_POSTGRESQL_RESULT_H
 
+#include <cstdint>
+#include <cstdlib>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <string>
+#include <type_traits>
 
 #include <libpq-fe.h>
 
@@ -40,6 +44,88 @@ namespace sqlpp
 {
   namespace postgresql
   {
+    namespace detail
+    {
+      // Numbers are parsed straight from the text libpq hands out (which is zero terminated), without copying
+      template <typename T>
+      T parse_floating_point(const char* text)
+      {
+        return static_cast<T>(std::strtod(text, nullptr));
+      }
+
+      template <>
+      inline long double parse_floating_point<long double>(const char* text)
+      {
+        return std::strtold(text, nullptr);
+      }
+
+      template <typename T>
+      T parse_number(const char* text, int length, std::false_type /* is_integral */)
+      {
+        return length == 0 ? T(0) : parse_floating_point<T>(text);
+      }
+
+      // Values out of the range of T are clamped to its limits, like the binary numeric decoder does, NaN is 0
+      template <typename T>
+      T clamp_integral(long double value)
+      {
+        if (value != value)
+        {
+          return T(0);
+        }
+        if (value >= static_cast<long double>(std::numeric_limits<T>::max()))
+        {
+          return std::numeric_limits<T>::max();
+        }
+        if (value <= static_cast<long double>(std::numeric_limits<T>::min()))
+        {
+          return std::numeric_limits<T>::min();
+        }
+        return static_cast<T>(value);
+      }
+
+      template <typename T>
+      T parse_number(const char* text, int length, std::true_type /* is_integral */)
+      {
+        const char* pos = text;
+        const char* const end = text + length;
+        const bool negative = (pos != end && *pos == '-');
+        if (pos != end && (*pos == '-' || *pos == '+'))
+        {
+          ++pos;
+        }
+
+        uint64_t value = 0;
+        for (; pos != end; ++pos)
+        {
+          const auto digit = static_cast<unsigned>(*pos - '0');
+          if (digit > 9 || value > (std::numeric_limits<uint64_t>::max() - digit) / 10)
+          {
+            // Not a plain integer (e.g. a numeric with fraction or exponent) or out of range
+            return clamp_integral<T>(std::strtold(text, nullptr));
+          }
+          value = value * 10 + digit;
+        }
+
+        if (negative)
+        {
+          // The magnitude of min(), written so that it does not overflow for signed types
+          const uint64_t lowest = std::numeric_limits<T>::is_signed
+                                      ? static_cast<uint64_t>(-(std::numeric_limits<T>::min() + 1)) + 1
+                                      : 0;
+          return value >= lowest ? std::numeric_limits<T>::min() : static_cast<T>(0 - value);
+        }
+        return value >= static_cast<uint64_t>(std::numeric_limits<T>::max()) ? std::numeric_limits<T>::max()
+                                                                               : static_cast<T>(value);
+      }
+
+      template <typename T>
+      T parse_number(const char* text, int length)
+      {
+        return parse_number<T>(text, length, std::is_integral<T>{});
+      }
+    }
+
     class DLL_PUBLIC Result
     {
     public:
@@ -55,6 +141,9 @@ namespace sqlpp
       int field_count() const;
       int length(int record, int field) const;
       bool isNull(int record, int field) const;
+      Oid field_type(int field) const;
+      const char* field_name(int field) const;
+      bool is_binary(int field) const;
       void operator=(PGresult* res);
       operator bool() const;
 
@@ -63,14 +152,7 @@ namespace sqlpp
       {
         static_assert(std::is_arithmetic<T>::value, "Value must be numeric type");
         checkIndex(record, field);
-        T t(0);
-        auto txt = std::string(getPqValue(m_result, record, field));
-        if(txt != "")
-
-        {
-          t = std::stold(txt);
-        }
-        return t;
+        return detail::parse_number<T>(getPqValue(m_result, record, field), getPqLength(m_result, record, field));
       }
 
       const std::string& query() const
@@ -93,6 +175,7 @@ namespace sqlpp
       // move PQgetvalue to implementation so we don't depend on the libpq in the
       // public interface
       const char* getPqValue(PGresult* result, int record, int field) const;
+      int getPqLength(PGresult* result, int record, int field) const;
 
       PGresult* m_result;
       std::string m_query;
@@ -0,0 +1,79 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_POSTGRESQL_TRACER_H
+#define SQLPP_POSTGRESQL_TRACER_H
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+    // Measurements of a completed statement
+    struct statement_stats_t
+    {
+      std::chrono::steady_clock::duration duration;
+      // Rows returned by a query, or affected by an INSERT, UPDATE or DELETE
+      std::size_t rows;
+      // Memory of the result as reported by PQresultMemorySize, 0 with libpq older than 12
+      std::size_t bytes;
+    };
+
+    // Hooks for monitoring the statements of a connection, install one with connection_config::tracer. The hooks are
+    // called on the thread that runs the statement, between sending it and handing out its result, so they should
+    // return quickly. They must not throw, they are also called when an unfinished statement is canceled. Statements
+    // are the executed text, for prepared statements the text they were prepared with. Streamed, asynchronous and
+    // pipelined statements and COPY end when their last result was read, the rows of a streamed query add up.
+    class tracer_t
+    {
+    public:
+      virtual ~tracer_t() = default;
+
+      // Before the statement is sent to the server
+      virtual void statement_start(const std::string& /* statement */)
+      {
+      }
+
+      // After the result of the statement was received
+      virtual void statement_end(const std::string& /* statement */, const statement_stats_t& /* stats */)
+      {
+      }
+
+      // The statement failed, instead of statement_end(). The error is thrown afterwards.
+      virtual void statement_error(const std::string& /* statement */,
+                                   const std::chrono::steady_clock::duration& /* duration */,
+                                   const std::string& /* message */)
+      {
+      }
+    };
+  }  // namespace postgresql
+}  // namespace sqlpp
+
+#endif
@@ -0,0 +1,146 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_POSTGRESQL_TYPE_OID_H
+#define SQLPP_POSTGRESQL_TYPE_OID_H
+
+#include <vector>
+
+#include <postgres_ext.h>
+#include <sqlpp11/data_types.h>
+#include <sqlpp11/parameter_list.h>
+
+namespace sqlpp
+{
+  template <typename ValueType>
+  struct array;
+  struct uuid;
+
+  namespace postgresql
+  {
+    // Object identifiers of the builtin types, as found in pg_type.dat of the server sources. libpq does not
+    // export these, so keep them here for everything that needs to send or interpret the binary format.
+    namespace type_oid
+    {
+      constexpr Oid unspecified = 0;
+      constexpr Oid boolean = 16;
+      constexpr Oid bytea = 17;
+      constexpr Oid character = 18;
+      constexpr Oid name = 19;
+      constexpr Oid int8 = 20;
+      constexpr Oid int2 = 21;
+      constexpr Oid int4 = 23;
+      constexpr Oid text = 25;
+      constexpr Oid oid = 26;
+      constexpr Oid json = 114;
+      constexpr Oid float4 = 700;
+      constexpr Oid float8 = 701;
+      constexpr Oid text_array = 1009;
+      constexpr Oid int8_array = 1016;
+      constexpr Oid bpchar = 1042;
+      constexpr Oid varchar = 1043;
+      constexpr Oid date = 1082;
+      constexpr Oid timestamp = 1114;
+      constexpr Oid timestamptz = 1184;
+      constexpr Oid timestamptz_array = 1185;
+      constexpr Oid numeric = 1700;
+      constexpr Oid uuid = 2950;
+      constexpr Oid uuid_array = 2951;
+      constexpr Oid jsonb = 3802;
+    }
+
+    namespace detail
+    {
+      // Type of the parameters sent in the binary format (see connection_config::binary_parameters). Everything
+      // else stays unspecified, is sent as text and typed by the server.
+      template <typename ValueType>
+      struct parameter_oid : std::integral_constant<Oid, type_oid::unspecified>
+      {
+      };
+
+      template <>
+      struct parameter_oid<::sqlpp::boolean> : std::integral_constant<Oid, type_oid::boolean>
+      {
+      };
+
+      template <>
+      struct parameter_oid<::sqlpp::integral> : std::integral_constant<Oid, type_oid::int8>
+      {
+      };
+
+      template <>
+      struct parameter_oid<::sqlpp::floating_point> : std::integral_constant<Oid, type_oid::float8>
+      {
+      };
+
+      template <>
+      struct parameter_oid<::sqlpp::day_point> : std::integral_constant<Oid, type_oid::date>
+      {
+      };
+
+      template <>
+      struct parameter_oid<::sqlpp::time_point> : std::integral_constant<Oid, type_oid::timestamptz>
+      {
+      };
+
+      template <>
+      struct parameter_oid<::sqlpp::array<::sqlpp::integral>> : std::integral_constant<Oid, type_oid::int8_array>
+      {
+      };
+
+      template <>
+      struct parameter_oid<::sqlpp::array<::sqlpp::text>> : std::integral_constant<Oid, type_oid::text_array>
+      {
+      };
+
+      template <>
+      struct parameter_oid<::sqlpp::array<::sqlpp::time_point>>
+          : std::integral_constant<Oid, type_oid::timestamptz_array>
+      {
+      };
+
+      template <>
+      struct parameter_oid<::sqlpp::array<::sqlpp::uuid>> : std::integral_constant<Oid, type_oid::uuid_array>
+      {
+      };
+
+      template <typename ParameterList>
+      struct parameter_oids;
+
+      template <typename... Parameter>
+      struct parameter_oids<::sqlpp::parameter_list_t<::sqlpp::detail::type_vector<Parameter...>>>
+      {
+        static std::vector<Oid> get()
+        {
+          return {parameter_oid<::sqlpp::value_type_of<Parameter>>::value...};
+        }
+      };
+    }
+  }
+}
+
+#endif
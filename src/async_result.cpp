@@ -0,0 +1,80 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp11/postgresql/async_result.h>
+
+#include "detail/async_handle.h"
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+    async_result_t::async_result_t(const std::shared_ptr<detail::async_handle_t>& handle) : _handle(handle)
+    {
+    }
+
+    int async_result_t::socket() const
+    {
+      return _handle->socket();
+    }
+
+    bool async_result_t::flushed() const
+    {
+      return _handle->flushed;
+    }
+
+    bool async_result_t::ready()
+    {
+      return _handle->poll();
+    }
+
+    void async_result_t::wait()
+    {
+      _handle->wait();
+    }
+
+    bind_result_t async_result_t::_bind_result()
+    {
+      wait();
+      if (_handle->error)
+      {
+        std::rethrow_exception(_handle->error);
+      }
+      return {_handle};
+    }
+
+    size_t async_result_t::affected_rows()
+    {
+      wait();
+      if (_handle->error)
+      {
+        std::rethrow_exception(_handle->error);
+      }
+      return static_cast<size_t>(_handle->result.affected_rows());
+    }
+  }
+}
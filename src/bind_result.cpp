@@ -29,12 +29,15 @@
 #include <sqlpp11/exception.h>
 #include <sqlpp11/postgresql/bind_result.h>
 
+#include <algorithm>
 #include <date/date.h>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
 
+#include "detail/binary_format.h"
 #include "detail/prepared_statement_handle.h"
+#include "detail/text_format.h"
 
 #if defined(_WIN32) || defined(_WIN64)
 #pragma warning(disable : 4800)  // int to bool
@@ -54,6 +57,334 @@ namespace sqlpp
       }
     }
 
+    // Decoding of results requested in the binary format (see connection_config::binary_results). The C++ type is
+    // given by the bind function, the width and encoding by the column type.
+    namespace
+    {
+      int64_t binary_integral(Oid type, const char* data)
+      {
+        switch (type)
+        {
+          case type_oid::int2:
+            return detail::read_int16(data);
+          case type_oid::int4:
+            return detail::read_int32(data);
+          case type_oid::oid:
+            return detail::read_uint32(data);
+          case type_oid::int8:
+            return detail::read_int64(data);
+          case type_oid::numeric:
+            return detail::read_numeric_as_int64(data);
+          case type_oid::boolean:
+            return *data != 0;
+          default:
+            throw sqlpp::exception("PostgreSQL error: cannot bind binary value of type " + std::to_string(type) +
+                                   " to an integral result");
+        }
+      }
+
+      double binary_floating_point(Oid type, const char* data)
+      {
+        switch (type)
+        {
+          case type_oid::float4:
+            return detail::read_float4(data);
+          case type_oid::float8:
+            return detail::read_float8(data);
+          case type_oid::numeric:
+            return detail::read_numeric_as_double(data);
+          case type_oid::int2:
+          case type_oid::int4:
+          case type_oid::oid:
+          case type_oid::int8:
+            return static_cast<double>(binary_integral(type, data));
+          default:
+            throw sqlpp::exception("PostgreSQL error: cannot bind binary value of type " + std::to_string(type) +
+                                   " to a floating point result");
+        }
+      }
+
+      // microseconds since 1970-01-01 for date, timestamp and timestamp with time zone values
+      int64_t binary_microseconds(Oid type, const char* data)
+      {
+        switch (type)
+        {
+          case type_oid::date:
+            return detail::read_date_microseconds(data);
+          case type_oid::timestamp:
+          case type_oid::timestamptz:
+            return detail::read_timestamp_microseconds(data);
+          default:
+            throw sqlpp::exception("PostgreSQL error: cannot bind binary value of type " + std::to_string(type) +
+                                   " to a date or timestamp result");
+        }
+      }
+
+      // Text results are passed through as is, apart from the few types that are commonly bound as text
+      bool binary_text(Oid type, const char* data, std::string& out)
+      {
+        out.clear();
+        switch (type)
+        {
+          case type_oid::uuid:
+            detail::append_uuid(out, data);
+            return true;
+          case type_oid::boolean:
+            out = *data ? "t" : "f";
+            return true;
+          case type_oid::int2:
+          case type_oid::int4:
+          case type_oid::oid:
+          case type_oid::int8:
+            out = std::to_string(binary_integral(type, data));
+            return true;
+          default:
+            return false;
+        }
+      }
+    }  // namespace
+
+    // Columnar decoding (see bind_result_t::fetch_columns): each column is decoded by a loop of its own, with the
+    // dispatch on the type hoisted out of the loop and the values written to presized vectors
+    namespace
+    {
+      result_column_t::kind_t column_kind(Oid type)
+      {
+        switch (type)
+        {
+          case type_oid::boolean:
+            return result_column_t::kind_t::boolean;
+          case type_oid::int2:
+          case type_oid::int4:
+          case type_oid::oid:
+          case type_oid::int8:
+            return result_column_t::kind_t::integral;
+          case type_oid::float4:
+          case type_oid::float8:
+          case type_oid::numeric:
+            return result_column_t::kind_t::floating_point;
+          case type_oid::date:
+            return result_column_t::kind_t::date;
+          case type_oid::timestamp:
+          case type_oid::timestamptz:
+            return result_column_t::kind_t::date_time;
+          default:
+            return result_column_t::kind_t::text;
+        }
+      }
+
+      // Decodes rows [first, first + count) of the field with decode(data, length), NULL values become T{}
+      template <typename T, typename Decode>
+      void append_values(const Result& result, int field, int first, int count, std::vector<T>& values, Decode decode)
+      {
+        const auto offset = values.size();
+        values.resize(offset + static_cast<size_t>(count));
+        T* const out = &values[offset];
+        for (int row = first; row < first + count; ++row)
+        {
+          out[row - first] = result.isNull(row, field)
+                                 ? T{}
+                                 : decode(result.getValue<const char*>(row, field), result.length(row, field));
+        }
+      }
+
+      // Binary values of a fixed width type
+      template <typename T, typename Source, Source (*Read)(const char*)>
+      struct decode_binary
+      {
+        T operator()(const char* data, int) const
+        {
+          return static_cast<T>(Read(data));
+        }
+      };
+
+      // Binary numeric values, which have a variable width
+      template <typename T>
+      struct decode_binary_numeric
+      {
+        T operator()(const char* data, int) const
+        {
+          return std::is_integral<T>::value ? static_cast<T>(detail::read_numeric_as_int64(data))
+                                            : static_cast<T>(detail::read_numeric_as_double(data));
+        }
+      };
+
+      template <typename T>
+      struct decode_text_number
+      {
+        T operator()(const char* text, int length) const
+        {
+          return detail::parse_number<T>(text, length);
+        }
+      };
+
+      struct decode_binary_boolean
+      {
+        uint8_t operator()(const char* data, int) const
+        {
+          return *data != 0;
+        }
+      };
+
+      struct decode_text_boolean
+      {
+        uint8_t operator()(const char* text, int) const
+        {
+          return *text == 't';
+        }
+      };
+
+      struct decode_binary_date
+      {
+        ::sqlpp::chrono::day_point operator()(const char* data, int) const
+        {
+          return ::sqlpp::chrono::day_point(::sqlpp::chrono::days(detail::read_date_days(data)));
+        }
+      };
+
+      struct decode_binary_date_time
+      {
+        Oid type;
+        ::sqlpp::chrono::microsecond_point operator()(const char* data, int) const
+        {
+          return ::sqlpp::chrono::microsecond_point(std::chrono::microseconds(binary_microseconds(type, data)));
+        }
+      };
+
+      struct decode_text_date
+      {
+        ::sqlpp::chrono::day_point operator()(const char* text, int length) const
+        {
+          ::sqlpp::chrono::day_point value{};
+          if (!detail::parse_iso_date(text, static_cast<size_t>(length), value))
+          {
+            value = {};
+          }
+          return value;
+        }
+      };
+
+      struct decode_text_date_time
+      {
+        ::sqlpp::chrono::microsecond_point operator()(const char* text, int length) const
+        {
+          ::sqlpp::chrono::microsecond_point value{};
+          if (!detail::parse_iso_date_time(text, static_cast<size_t>(length), value))
+          {
+            value = {};
+          }
+          return value;
+        }
+      };
+
+      // Integral and floating point columns share the dispatch on the binary width
+      template <typename T>
+      void append_numbers(const Result& result, int field, int first, int count, std::vector<T>& values)
+      {
+        if (!result.is_binary(field))
+        {
+          append_values(result, field, first, count, values, decode_text_number<T>{});
+          return;
+        }
+        switch (result.field_type(field))
+        {
+          case type_oid::int2:
+            append_values(result, field, first, count, values, decode_binary<T, int16_t, detail::read_int16>{});
+            break;
+          case type_oid::int4:
+            append_values(result, field, first, count, values, decode_binary<T, int32_t, detail::read_int32>{});
+            break;
+          case type_oid::oid:
+            append_values(result, field, first, count, values, decode_binary<T, uint32_t, detail::read_uint32>{});
+            break;
+          case type_oid::int8:
+            append_values(result, field, first, count, values, decode_binary<T, int64_t, detail::read_int64>{});
+            break;
+          case type_oid::float4:
+            append_values(result, field, first, count, values, decode_binary<T, float, detail::read_float4>{});
+            break;
+          case type_oid::float8:
+            append_values(result, field, first, count, values, decode_binary<T, double, detail::read_float8>{});
+            break;
+          default:
+            append_values(result, field, first, count, values, decode_binary_numeric<T>{});
+        }
+      }
+
+      void append_text(
+          const Result& result, int field, int first, int count, result_column_t& column, std::string& buffer)
+      {
+        const bool binary = result.is_binary(field);
+        const auto type = result.field_type(field);
+        for (int row = first; row < first + count; ++row)
+        {
+          if (!result.isNull(row, field))
+          {
+            const auto data = result.getValue<const char*>(row, field);
+            if (binary && binary_text(type, data, buffer))
+            {
+              column.data.append(buffer);
+            }
+            else
+            {
+              column.data.append(data, static_cast<size_t>(result.length(row, field)));
+            }
+          }
+          column.offsets.push_back(column.data.size());
+        }
+      }
+
+      // Appends rows [first, first + count) of the field to the column, which holds `offset` rows already
+      void append_column(const Result& result,
+                         int field,
+                         int first,
+                         int count,
+                         size_t offset,
+                         result_column_t& column,
+                         std::string& buffer)
+      {
+        column.nulls.resize((offset + static_cast<size_t>(count) + 63) / 64);
+        for (int row = 0; row < count; ++row)
+        {
+          const auto bit = offset + static_cast<size_t>(row);
+          column.nulls[bit / 64] |= static_cast<uint64_t>(result.isNull(first + row, field)) << (bit % 64);
+        }
+
+        const bool binary = result.is_binary(field);
+        switch (column.kind)
+        {
+          case result_column_t::kind_t::boolean:
+            if (binary)
+              append_values(result, field, first, count, column.booleans, decode_binary_boolean{});
+            else
+              append_values(result, field, first, count, column.booleans, decode_text_boolean{});
+            break;
+          case result_column_t::kind_t::integral:
+            append_numbers(result, field, first, count, column.integrals);
+            break;
+          case result_column_t::kind_t::floating_point:
+            append_numbers(result, field, first, count, column.floating_points);
+            break;
+          case result_column_t::kind_t::date:
+            if (binary)
+              append_values(result, field, first, count, column.dates, decode_binary_date{});
+            else
+              append_values(result, field, first, count, column.dates, decode_text_date{});
+            break;
+          case result_column_t::kind_t::date_time:
+            if (binary)
+              append_values(result, field, first, count, column.date_times,
+                            decode_binary_date_time{result.field_type(field)});
+            else
+              append_values(result, field, first, count, column.date_times, decode_text_date_time{});
+            break;
+          case result_column_t::kind_t::text:
+            append_text(result, field, first, count, column, buffer);
+            break;
+        }
+      }
+    }  // namespace
+
     bool bind_result_t::next_impl()
     {
       if (_handle->debug())
@@ -61,24 +392,22 @@ namespace sqlpp
         std::cerr << "PostgreSQL debug: accessing next row of handle at " << _handle.get() << std::endl;
       }
 
-      // Fetch total amount
-      if (_handle->totalCount == 0U)
+      // Next row
+      if (_handle->totalCount != 0U && _handle->count < (_handle->totalCount - 1))
       {
-        _handle->totalCount = _handle->result.records_size();
-        if (_handle->totalCount == 0U)
-          return false;
+        _handle->count++;
       }
       else
       {
-        // Next row
-        if (_handle->count < (_handle->totalCount - 1))
-        {
-          _handle->count++;
-        }
-        else
-        {
+        // Start of the result or the current rows are exhausted, a streaming handle continues with the next rows
+        if (!_handle->fetch_next_result() && _handle->totalCount != 0U)
+          return false;
+
+        // Fetch total amount
+        _handle->count = 0;
+        _handle->totalCount = _handle->result.records_size();
+        if (_handle->totalCount == 0U)
           return false;
-        }
       }
 
       // Really needed?
@@ -99,6 +428,11 @@ namespace sqlpp
       }
 
       *is_null = _handle->result.isNull(_handle->count, index);
+      if (_handle->result.is_binary(index))
+      {
+        *value = !*is_null && *_handle->result.getValue<const char*>(_handle->count, index) != 0;
+        return;
+      }
       *value = _handle->result.getValue<bool>(_handle->count, index);
     }
 
@@ -111,6 +445,12 @@ namespace sqlpp
       }
 
       *is_null = _handle->result.isNull(_handle->count, index);
+      if (_handle->result.is_binary(index))
+      {
+        *value = *is_null ? 0 : binary_floating_point(_handle->result.field_type(index),
+                                                      _handle->result.getValue<const char*>(_handle->count, index));
+        return;
+      }
       *value = _handle->result.getValue<double>(_handle->count, index);
     }
 
@@ -123,7 +463,13 @@ namespace sqlpp
       }
 
       *is_null = _handle->result.isNull(_handle->count, index);
-      *value = _handle->result.getValue<unsigned long long>(_handle->count, index);
+      if (_handle->result.is_binary(index))
+      {
+        *value = *is_null ? 0 : binary_integral(_handle->result.field_type(index),
+                                                _handle->result.getValue<const char*>(_handle->count, index));
+        return;
+      }
+      *value = _handle->result.getValue<int64_t>(_handle->count, index);
     }
 
     void bind_result_t::_bind_text_result(size_t _index, const char** value, size_t* len)
@@ -143,48 +489,14 @@ namespace sqlpp
       {
         *value = _handle->result.getValue<const char*>(_handle->count, index);
         *len = _handle->result.length(_handle->count, index);
-      }
-    }
-
-    // same parsing logic as SQLite connector
-    // PostgreSQL will return one of those (using the default ISO client):
-    //
-    // 2010-10-11 01:02:03 - ISO timestamp without timezone
-    // 2011-11-12 01:02:03.123456 - ISO timesapt with sub-second (microsecond) precision
-    // 1997-12-17 07:37:16-08 - ISO timestamp with timezone
-    // 1992-10-10 01:02:03-06:30 - for some timezones with non-hour offset
-    // 1900-01-01 - date only
-    // we do not support time-only values !
-    namespace
-    {
-      const auto date_digits = std::vector<char>{1, 1, 1, 1, 0, 1, 1, 0, 1, 1};  // 2016-11-10
-      const auto time_digits = std::vector<char>{0, 1, 1, 0, 1, 1, 0, 1, 1};     // ' 13:12:11'
-      const auto tz_digits = std::vector<char>{0, 1, 1};                         // -05
-      const auto tz_min_digits = std::vector<char>{0, 1, 1};                     // :30
-
-      auto check_digits(const char* text, const std::vector<char>& digitFlags) -> bool
-      {
-        for (const auto digitFlag : digitFlags)
+        if (_handle->result.is_binary(index) &&
+            binary_text(_handle->result.field_type(index), *value, _handle->binaryText))
         {
-          if (digitFlag)
-          {
-            if (not std::isdigit(*text))
-            {
-              return false;
-            }
-          }
-          else
-          {
-            if (std::isdigit(*text) or *text == '\0')
-            {
-              return false;
-            }
-          }
-          ++text;
+          *value = _handle->binaryText.c_str();
+          *len = _handle->binaryText.size();
         }
-        return true;
       }
-    }  // namespace
+    }
 
     void bind_result_t::_bind_date_result(size_t _index, ::sqlpp::chrono::day_point* value, bool* is_null)
     {
@@ -197,7 +509,21 @@ namespace sqlpp
 
       *is_null = _handle->result.isNull(_handle->count, index);
 
-      if (!(*is_null))
+      if (!(*is_null) && _handle->result.is_binary(index))
+      {
+        const auto type = _handle->result.field_type(index);
+        const auto data = _handle->result.getValue<const char*>(_handle->count, index);
+        if (type == type_oid::date)
+        {
+          *value = ::sqlpp::chrono::day_point(::sqlpp::chrono::days(detail::read_date_days(data)));
+        }
+        else
+        {
+          *value = ::sqlpp::chrono::floor<::date::days>(
+              ::sqlpp::chrono::microsecond_point(std::chrono::microseconds(binary_microseconds(type, data))));
+        }
+      }
+      else if (!(*is_null))
       {
         const auto date_string = _handle->result.getValue<const char*>(_handle->count, index);
 
@@ -205,15 +531,8 @@ namespace sqlpp
         {
           std::cerr << "PostgreSQL debug: date string: " << date_string << std::endl;
         }
-        auto len = static_cast<size_t>(_handle->result.length(_handle->count, index));
-
-        if (len >= date_digits.size() && check_digits(date_string, date_digits))
-        {
-          const auto ymd =
-              ::date::year(std::atoi(date_string)) / std::atoi(date_string + 5) / std::atoi(date_string + 8);
-          *value = ::sqlpp::chrono::day_point(ymd);
-        }
-        else
+        const auto len = static_cast<size_t>(_handle->result.length(_handle->count, index));
+        if (!detail::parse_iso_date(date_string, len, *value))
         {
           if (_handle->debug())
             std::cerr << "PostgreSQL debug: got invalid date '" << date_string << "'" << std::endl;
@@ -226,7 +545,7 @@ namespace sqlpp
       }
     }
 
-    // always returns local time for timestamp with time zone
+    // always returns local time for timestamp with time zone (UTC for results in the binary format)
     void bind_result_t::_bind_date_time_result(size_t _index, ::sqlpp::chrono::microsecond_point* value, bool* is_null)
     {
       auto index = static_cast<int>(_index);
@@ -237,7 +556,12 @@ namespace sqlpp
 
       *is_null = _handle->result.isNull(_handle->count, index);
 
-      if (!(*is_null))
+      if (!(*is_null) && _handle->result.is_binary(index))
+      {
+        *value = ::sqlpp::chrono::microsecond_point(std::chrono::microseconds(binary_microseconds(
+            _handle->result.field_type(index), _handle->result.getValue<const char*>(_handle->count, index))));
+      }
+      else if (!(*is_null))
       {
         const auto date_string = _handle->result.getValue(_handle->count, index);
 
@@ -245,100 +569,84 @@ namespace sqlpp
         {
           std::cerr << "PostgreSQL debug: got date_time string: " << date_string << std::endl;
         }
-        auto len = static_cast<size_t>(_handle->result.length(_handle->count, index));
-        if (len >= date_digits.size() && check_digits(date_string, date_digits))
-        {
-          const auto ymd =
-              ::date::year(std::atoi(date_string)) / std::atoi(date_string + 5) / std::atoi(date_string + 8);
-          *value = ::sqlpp::chrono::day_point(ymd);
-        }
-        else
+        const auto len = static_cast<size_t>(_handle->result.length(_handle->count, index));
+        if (!detail::parse_iso_date_time(date_string, len, *value))
         {
           if (_handle->debug())
             std::cerr << "PostgreSQL debug: got invalid date_time" << std::endl;
           *value = {};
           return;
         }
+        if (_handle->debug())
+        {
+          auto ts = std::chrono::system_clock::to_time_t(*value);
+          std::cerr << "PostgreSQL debug: calculated timestamp " << std::put_time(std::localtime(&ts), "%F %T %Z")
+                    << std::endl;
+        }
+      }
+      else
+      {
+        *value = {};
+      }
+    }
+
+    size_t bind_result_t::fetch_columns(column_batch_t& batch, size_t max_rows)
+    {
+      batch.clear();
+      if (!_handle)
+      {
+        return 0;
+      }
 
-        auto date_time_size = date_digits.size() + time_digits.size();
-        const auto time_string = date_string + date_digits.size();
-        if ((len >= date_time_size) && check_digits(date_string, date_digits))
+      while (batch.rows < max_rows)
+      {
+        // The rows after the current one, or those of the next result once the current rows are exhausted
+        int first = static_cast<int>(_handle->count) + 1;
+        if (_handle->totalCount == 0U || _handle->count + 1 >= _handle->totalCount)
         {
-          // not the ' ' (or standard: 'T') prefix for times
-          *value += std::chrono::hours(std::atoi(time_string + 1)) + std::chrono::minutes(std::atoi(time_string + 4)) +
-                    std::chrono::seconds(std::atoi(time_string + 7));
+          if (!_handle->fetch_next_result() && _handle->totalCount != 0U)
+            break;
+          _handle->count = 0;
+          _handle->totalCount = _handle->result.records_size();
+          if (_handle->totalCount == 0U)
+            break;
+          first = 0;
         }
-        else
+        if (_handle->fields == 0U)
         {
-          return;
+          _handle->fields = _handle->result.field_count();
         }
 
-        if ((len > date_time_size) && (time_string[time_digits.size()] == '.'))
+        const auto& result = _handle->result;
+        const auto fields = result.field_count();
+        if (batch.rows == 0)
         {
-          date_time_size++;  // Taking the '.' into account
-          const auto ms_string = time_string + time_digits.size() + 1;
-
-          int digits_count = 0;
-          while (ms_string[digits_count] != '\0' && ms_string[digits_count] != '-' && ms_string[digits_count] != '+')
+          batch.columns.resize(static_cast<size_t>(fields));
+          for (int field = 0; field < fields; ++field)
           {
-            if (!std::isdigit(ms_string[digits_count]))
-            {
-              if (_handle->debug())
-                std::cerr << "PostgreSQL debug: got invalid date_time" << std::endl;
-              *value = {};
-              return;
-            }
-
-            ++digits_count;
-          }
-
-          if (digits_count == 0)
-          {
-            if (_handle->debug())
-              std::cerr << "PostgreSQL debug: got invalid date_time" << std::endl;
-            *value = {};
-            return;
+            auto& column = batch.columns[static_cast<size_t>(field)];
+            column.name = result.field_name(field);
+            column.kind = column_kind(result.field_type(field));
+            column.clear();
           }
-
-          date_time_size += digits_count;
-
-          int pg_ms_num = std::atoi(ms_string);
-
-          while (digits_count++ < 6)
-            pg_ms_num *= 10;
-
-          *value += std::chrono::microseconds(pg_ms_num);
         }
-        if (len >= (date_time_size + tz_digits.size()))
-        {
-          const auto tz_string = date_string + date_time_size;
-          const auto zone_hour = std::atoi(tz_string);
-          auto zone_min = 0;
 
-          if ((len >= date_time_size + tz_digits.size() + tz_min_digits.size()) &&
-              check_digits(tz_string + tz_digits.size(), tz_min_digits))
-          {
-            zone_min = std::atoi(tz_string + tz_digits.size() + 1);
-          }
-          if (_handle->debug())
-          {
-            std::cerr << "PostgreSQL debug: Timezone is " << zone_hour << " : " << zone_min << std::endl;
-          }
-          *value += std::chrono::hours(zone_hour);
-          // minutes should be removed from timestamp if TZ is -XX:YY
-          *value += (zone_hour >= 0 ? 1 : -1) * std::chrono::minutes(zone_min);
-        }
-        if (_handle->debug())
+        const auto count = static_cast<int>(
+            std::min(static_cast<size_t>(_handle->totalCount) - static_cast<size_t>(first), max_rows - batch.rows));
+        for (int field = 0; field < fields; ++field)
         {
-          auto ts = std::chrono::system_clock::to_time_t(*value);
-          std::cerr << "PostgreSQL debug: calculated timestamp " << std::put_time(std::localtime(&ts), "%F %T %Z")
-                    << std::endl;
+          append_column(result, field, first, count, batch.rows, batch.columns[static_cast<size_t>(field)],
+                        _handle->binaryText);
         }
+        batch.rows += static_cast<size_t>(count);
+        _handle->count = static_cast<uint32_t>(first + count - 1);
       }
-      else
+
+      if (_handle->debug())
       {
-        *value = {};
+        std::cerr << "PostgreSQL debug: decoded " << batch.rows << " rows into columns" << std::endl;
       }
+      return batch.rows;
     }
 
     int bind_result_t::size() const
@@ -38,8 +38,13 @@
 #include "make_unique.h"
 #endif
 
+#include "detail/async_handle.h"
 #include "detail/connection_handle.h"
+#include "detail/copy_out_handle.h"
+#include "detail/cursor_handle.h"
 #include "detail/prepared_statement_handle.h"
+#include "detail/statement_trace.h"
+#include "detail/stream_handle.h"
 
 #ifdef SQLPP_DYNAMIC_LOADING
 #include <sqlpp11/postgresql/dynamic_libpq.h>
@@ -55,16 +60,47 @@ namespace sqlpp
 
     namespace
     {
-      std::unique_ptr<detail::prepared_statement_handle_t> prepare_statement(detail::connection_handle& handle,
+      // Statement text followed by the parameter types, identifies statements in the statement cache
+      std::string statement_cache_key(const std::string& stmt, const std::vector<Oid>& paramTypes)
+      {
+        std::string key = stmt;
+        key.push_back('\0');
+        key.append(reinterpret_cast<const char*>(paramTypes.data()), paramTypes.size() * sizeof(Oid));
+        return key;
+      }
+
+      std::shared_ptr<detail::prepared_statement_handle_t> prepare_statement(detail::connection_handle& handle,
                                                                              const std::string& stmt,
-                                                                             const size_t& paramCount)
+                                                                             const size_t& paramCount,
+                                                                             const std::vector<Oid>& paramTypes)
       {
+        const auto& types = handle.config->binary_parameters ? paramTypes : std::vector<Oid>{};
+        const bool cached = handle.config->statement_cache_size != 0;
+        const auto key = cached ? statement_cache_key(stmt, types) : std::string{};
+        if (cached)
+        {
+          if (auto statement = handle.cached_statement(key))
+          {
+            if (handle.config->debug)
+            {
+              std::cerr << "PostgreSQL debug: reusing: " << statement->name() << std::endl;
+            }
+            return statement;
+          }
+        }
+
         if (handle.config->debug)
         {
           std::cerr << "PostgreSQL debug: preparing: " << stmt << std::endl;
         }
+        handle.flush_deallocations();
 
-        return std::make_unique<detail::prepared_statement_handle_t>(handle, stmt, paramCount);
+        auto statement = std::make_shared<detail::prepared_statement_handle_t>(handle, stmt, paramCount, types);
+        if (cached)
+        {
+          return handle.cache_statement(key, statement);
+        }
+        return statement;
       }
 
       void execute_prepared_statement(detail::connection_handle& handle, detail::prepared_statement_handle_t& prepared)
@@ -73,6 +109,7 @@ namespace sqlpp
         {
           std::cerr << "PostgreSQL debug: executing: " << prepared.name() << std::endl;
         }
+        handle.flush_deallocations();
         prepared.execute();
       }
     }
@@ -119,9 +156,13 @@ namespace sqlpp
       {
         std::cerr << "PostgreSQL debug: executing: " << stmt << std::endl;
       }
+      _handle->flush_deallocations();
 
       auto result = std::make_shared<detail::statement_handle_t>(*_handle);
-      result->result = PQexec(_handle->native(), stmt.c_str());
+      detail::statement_trace_t trace(*_handle, stmt);
+      PGresult* res = PQexec(_handle->native(), stmt.c_str());
+      trace.finish(res);
+      result->result = res;
       result->valid = true;
 
       return result;
@@ -148,10 +189,12 @@ namespace sqlpp
     }
 
     // prepared execution
-    prepared_statement_t connection::prepare_impl(const std::string& stmt, const size_t& paramCount)
+    prepared_statement_t connection::prepare_impl(const std::string& stmt,
+                                                  const size_t& paramCount,
+                                                  const std::vector<Oid>& paramTypes)
     {
       validate_connection_handle();
-      return {prepare_statement(*_handle, stmt, paramCount)};
+      return {prepare_statement(*_handle, stmt, paramCount, paramTypes)};
     }
 
     bind_result_t connection::run_prepared_select_impl(prepared_statement_t& prep)
@@ -189,6 +232,126 @@ namespace sqlpp
       return prep._handle->result.affected_rows();
     }
 
+    // streaming execution
+    bind_result_t connection::stream_impl(const std::string& stmt, int chunk_rows)
+    {
+      validate_connection_handle();
+      if (_handle->config->debug)
+      {
+        std::cerr << "PostgreSQL debug: streaming: " << stmt << std::endl;
+      }
+
+      auto trace = detail::start_trace(*_handle, stmt);
+      if (!PQsendQuery(_handle->native(), stmt.c_str()))
+      {
+        detail::finish_trace(trace, nullptr);
+        throw sqlpp::exception("PostgreSQL error: could not send query: " +
+                               std::string(PQerrorMessage(_handle->native())));
+      }
+      auto handle = std::make_shared<detail::stream_handle_t>(*_handle);
+      handle->trace = std::move(trace);
+      handle->start(chunk_rows);
+      return {handle};
+    }
+
+    bind_result_t connection::stream_prepared_impl(prepared_statement_t& prep, int chunk_rows)
+    {
+      validate_connection_handle();
+      if (_handle->config->debug)
+      {
+        std::cerr << "PostgreSQL debug: streaming: " << prep._handle->name() << std::endl;
+      }
+
+      auto trace = detail::start_trace(*_handle, prep._handle->statement(), prep._handle->metrics());
+      if (!prep._handle->send())
+      {
+        detail::finish_trace(trace, nullptr);
+        throw sqlpp::exception("PostgreSQL error: could not send query: " +
+                               std::string(PQerrorMessage(_handle->native())));
+      }
+      auto handle = std::make_shared<detail::stream_handle_t>(*_handle);
+      handle->trace = std::move(trace);
+      handle->start(chunk_rows);
+      return {handle};
+    }
+
+    async_result_t connection::async_impl(const std::string& stmt)
+    {
+      validate_connection_handle();
+      if (_handle->config->debug)
+      {
+        std::cerr << "PostgreSQL debug: sending: " << stmt << std::endl;
+      }
+
+      auto handle = std::make_shared<detail::async_handle_t>(*_handle);
+      handle->send(stmt);
+      return {handle};
+    }
+
+    async_result_t connection::async_prepared_impl(prepared_statement_t& prep)
+    {
+      validate_connection_handle();
+      if (_handle->config->debug)
+      {
+        std::cerr << "PostgreSQL debug: sending: " << prep._handle->name() << std::endl;
+      }
+
+      auto handle = std::make_shared<detail::async_handle_t>(*_handle);
+      handle->send(*prep._handle);
+      return {handle};
+    }
+
+    bind_result_t connection::cursor_impl(const std::string& stmt, int fetch_size)
+    {
+      validate_connection_handle();
+      if (!_transaction_active)
+      {
+        throw sqlpp::exception("PostgreSQL error: a cursor requires an active transaction");
+      }
+      if (fetch_size < 1)
+      {
+        throw sqlpp::exception("PostgreSQL error: invalid cursor fetch size " + std::to_string(fetch_size));
+      }
+
+      auto handle = std::make_shared<detail::cursor_handle_t>(
+          *_handle, "sqlpp_cursor_" + std::to_string(++_handle->cursor_count), fetch_size);
+      handle->declare(stmt);
+      return {handle};
+    }
+
+    copy_writer_t connection::copy_in_impl(const std::string& table, const std::vector<std::string>& columns)
+    {
+      validate_connection_handle();
+      std::string column_list;
+      for (const auto& column : columns)
+      {
+        column_list += (column_list.empty() ? "" : ", ") + column;
+      }
+
+      // The binary format has to match the column types exactly, so ask the server for them
+      const auto description = execute("SELECT " + column_list + " FROM " + table + " LIMIT 0");
+      std::vector<Oid> types;
+      for (int i = 0; i < description->result.field_count(); ++i)
+      {
+        types.push_back(description->result.field_type(i));
+      }
+
+      return {*_handle, "COPY " + table + " (" + column_list + ") FROM STDIN (FORMAT binary)", std::move(types)};
+    }
+
+    bind_result_t connection::copy_out_impl(const std::string& stmt, int chunk_rows)
+    {
+      validate_connection_handle();
+      if (chunk_rows < 1)
+      {
+        throw sqlpp::exception("PostgreSQL error: invalid COPY chunk size " + std::to_string(chunk_rows));
+      }
+
+      auto handle = std::make_shared<detail::copy_out_handle_t>(*_handle, chunk_rows);
+      handle->start(stmt);
+      return {handle};
+    }
+
     void connection::set_default_isolation_level(isolation_level level)
     {
       std::string level_str = "read uncommmitted";
@@ -246,15 +409,21 @@ namespace sqlpp
     // TODO: Fix escaping.
     std::string connection::escape(const std::string& s) const
     {
-      validate_connection_handle();
-      // Escape strings
       std::string result;
-      result.resize((s.size() * 2) + 1);
+      escape(s, result);
+      return result;
+    }
+
+    void connection::escape(const std::string& s, std::string& target) const
+    {
+      validate_connection_handle();
+      // Escape strings, in place at the end of target
+      const auto offset = target.size();
+      target.resize(offset + (s.size() * 2) + 1);
 
       int err;
-      size_t length = PQescapeStringConn(_handle->postgres, &result[0], s.c_str(), s.size(), &err);
-      result.resize(length);
-      return result;
+      size_t length = PQescapeStringConn(_handle->postgres, &target[offset], s.c_str(), s.size(), &err);
+      target.resize(offset + length);
     }
 
     //! start transaction
@@ -371,5 +540,14 @@ namespace sqlpp
     {
       return _handle->postgres;
     }
+
+    metrics_snapshot_t connection::metrics() const
+    {
+      if (!_handle || !_handle->metrics)
+      {
+        return {};
+      }
+      return _handle->metrics->snapshot();
+    }
   }
 }
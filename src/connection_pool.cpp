@@ -0,0 +1,326 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp11/exception.h>
+#include <sqlpp11/postgresql/connection_pool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if __cplusplus == 201103L
+#include "make_unique.h"
+#endif
+
+#ifdef SQLPP_DYNAMIC_LOADING
+#include <sqlpp11/postgresql/dynamic_libpq.h>
+#endif
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+#ifdef SQLPP_DYNAMIC_LOADING
+    using namespace dynamic;
+#endif
+
+    namespace detail
+    {
+      struct connection_pool_state_t
+      {
+        using clock = std::chrono::steady_clock;
+
+        struct idle_connection
+        {
+          std::unique_ptr<connection> conn;
+          clock::time_point since;
+        };
+
+        struct shard
+        {
+          std::mutex mutex;
+          // Most recently released last
+          std::vector<idle_connection> idle;
+        };
+
+        const std::shared_ptr<connection_config> config;
+        const std::size_t maxConnections;
+        const std::chrono::milliseconds maxIdle;
+        const std::size_t shardCount;
+        std::unique_ptr<shard[]> shards;
+        std::atomic<std::size_t> open{0};
+
+        // Threads waiting for a connection when max_connections are in use, woken up when a connection is released
+        // or closed (counted in generation)
+        std::mutex waitMutex;
+        std::condition_variable available;
+        std::atomic<std::size_t> waiting{0};
+        std::atomic<uint64_t> generation{0};
+
+        connection_pool_state_t(const std::shared_ptr<connection_config>& _config,
+                                std::size_t _maxConnections,
+                                std::chrono::milliseconds _maxIdle)
+            : config(_config),
+              maxConnections(_maxConnections),
+              maxIdle(_maxIdle),
+              shardCount(std::max<std::size_t>(
+                  1, std::min<std::size_t>(_maxConnections, std::max(1U, std::thread::hardware_concurrency())))),
+              shards(new shard[shardCount])
+        {
+        }
+
+        // The shard a thread prefers, computed once per thread
+        std::size_t home_shard() const
+        {
+          static thread_local const std::size_t hash = std::hash<std::thread::id>()(std::this_thread::get_id());
+          return hash % shardCount;
+        }
+
+        static bool healthy(connection& conn)
+        {
+          return PQstatus(conn.native_handle()) == CONNECTION_OK;
+        }
+
+        void close(std::unique_ptr<connection> conn)
+        {
+          conn.reset();
+          --open;
+          notify();
+        }
+
+        void notify()
+        {
+          ++generation;
+          if (waiting > 0)
+          {
+            std::lock_guard<std::mutex> lock(waitMutex);
+            available.notify_all();
+          }
+        }
+
+        // Takes the most recently used healthy connection of a shard, closes expired or broken ones on the way
+        std::unique_ptr<connection> take(shard& s, bool block)
+        {
+          std::unique_lock<std::mutex> lock(s.mutex, std::defer_lock);
+          if (block)
+            lock.lock();
+          else if (!lock.try_lock())
+            return nullptr;
+
+          std::vector<std::unique_ptr<connection>> expired;
+          std::unique_ptr<connection> result;
+          reap(s, expired);
+          while (!result && !s.idle.empty())
+          {
+            auto candidate = std::move(s.idle.back().conn);
+            s.idle.pop_back();
+            if (healthy(*candidate))
+              result = std::move(candidate);
+            else
+              expired.push_back(std::move(candidate));
+          }
+          lock.unlock();
+
+          for (auto& conn : expired)
+          {
+            close(std::move(conn));
+          }
+          return result;
+        }
+
+        // Moves the connections idle for longer than maxIdle out of the shard, the caller holds its lock
+        void reap(shard& s, std::vector<std::unique_ptr<connection>>& expired)
+        {
+          const auto oldest = clock::now() - maxIdle;
+          auto end = std::find_if(s.idle.begin(), s.idle.end(),
+                                  [&oldest](const idle_connection& entry) { return entry.since >= oldest; });
+          for (auto it = s.idle.begin(); it != end; ++it)
+          {
+            expired.push_back(std::move(it->conn));
+          }
+          s.idle.erase(s.idle.begin(), end);
+        }
+
+        // Tries the home shard first, the other shards are skipped while locked unless block is set
+        std::unique_ptr<connection> take_any(bool block)
+        {
+          const auto home = home_shard();
+          if (auto conn = take(shards[home], true))
+            return conn;
+          for (std::size_t i = 1; i < shardCount; ++i)
+          {
+            if (auto conn = take(shards[(home + i) % shardCount], block))
+              return conn;
+          }
+          return nullptr;
+        }
+
+        bool reserve()
+        {
+          auto current = open.load();
+          while (current < maxConnections)
+          {
+            if (open.compare_exchange_weak(current, current + 1))
+              return true;
+          }
+          return false;
+        }
+
+        std::unique_ptr<connection> get(std::chrono::milliseconds timeout)
+        {
+          const auto deadline = clock::now() + timeout;
+          while (true)
+          {
+            const uint64_t seen = generation;
+            if (auto conn = take_any(false))
+              return conn;
+
+            if (reserve())
+            {
+              try
+              {
+                return std::make_unique<connection>(config);
+              }
+              catch (...)
+              {
+                --open;
+                notify();
+                throw;
+              }
+            }
+
+            // All connections are open, a shard skipped above may still have idle ones
+            if (auto conn = take_any(true))
+              return conn;
+
+            std::unique_lock<std::mutex> lock(waitMutex);
+            ++waiting;
+            const bool released = available.wait_until(lock, deadline, [this, seen] { return generation != seen; });
+            --waiting;
+            if (!released)
+            {
+              throw sqlpp::exception("PostgreSQL error: no pooled connection available");
+            }
+          }
+        }
+
+        void release(std::unique_ptr<connection> conn)
+        {
+          auto& s = shards[home_shard()];
+          std::vector<std::unique_ptr<connection>> expired;
+          {
+            std::lock_guard<std::mutex> lock(s.mutex);
+            reap(s, expired);
+            s.idle.push_back(idle_connection{std::move(conn), clock::now()});
+          }
+          for (auto& old : expired)
+          {
+            close(std::move(old));
+          }
+          notify();
+        }
+      };
+    }
+
+    pooled_connection_t::pooled_connection_t(const std::shared_ptr<detail::connection_pool_state_t>& pool,
+                                             std::unique_ptr<connection>&& connection)
+        : _pool(pool), _connection(std::move(connection))
+    {
+    }
+
+    pooled_connection_t::~pooled_connection_t()
+    {
+      if (!_connection)
+      {
+        return;
+      }
+
+      const auto native = _connection->native_handle();
+      if (_reusable && PQstatus(native) == CONNECTION_OK && PQtransactionStatus(native) == PQTRANS_IDLE)
+      {
+        _pool->release(std::move(_connection));
+      }
+      else
+      {
+        _pool->close(std::move(_connection));
+      }
+    }
+
+    connection_pool::connection_pool(const std::shared_ptr<connection_config>& config,
+                                     std::size_t max_connections,
+                                     std::chrono::milliseconds max_idle)
+        : _state(std::make_shared<detail::connection_pool_state_t>(config, max_connections, max_idle))
+    {
+      if (max_connections == 0)
+      {
+        throw sqlpp::exception("PostgreSQL error: a connection pool needs at least one connection");
+      }
+    }
+
+    pooled_connection_t connection_pool::get(std::chrono::milliseconds timeout)
+    {
+      return {_state, _state->get(timeout)};
+    }
+
+    std::size_t connection_pool::size() const
+    {
+      return _state->open;
+    }
+
+    std::size_t connection_pool::idle() const
+    {
+      std::size_t count = 0;
+      for (std::size_t i = 0; i < _state->shardCount; ++i)
+      {
+        std::lock_guard<std::mutex> lock(_state->shards[i].mutex);
+        count += _state->shards[i].idle.size();
+      }
+      return count;
+    }
+
+    void connection_pool::reap_idle()
+    {
+      for (std::size_t i = 0; i < _state->shardCount; ++i)
+      {
+        std::vector<std::unique_ptr<connection>> expired;
+        {
+          std::lock_guard<std::mutex> lock(_state->shards[i].mutex);
+          _state->reap(_state->shards[i], expired);
+        }
+        for (auto& conn : expired)
+        {
+          _state->close(std::move(conn));
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,441 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp11/exception.h>
+#include <sqlpp11/postgresql/connection_config.h>
+#include <sqlpp11/postgresql/copy.h>
+#include <sqlpp11/postgresql/result.h>
+
+#include <date/date.h>
+#include <cstdio>
+#include <limits>
+
+#include "detail/binary_format.h"
+#include "detail/connection_handle.h"
+#include "detail/statement_trace.h"
+
+#ifdef SQLPP_DYNAMIC_LOADING
+#include <sqlpp11/postgresql/dynamic_libpq.h>
+#endif
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+#ifdef SQLPP_DYNAMIC_LOADING
+    using namespace dynamic;
+#endif
+
+    namespace
+    {
+      // Signature, flags and header extension length of the binary COPY format
+      const char copy_header[] = "PGCOPY\n\377\r\n\0\0\0\0\0\0\0\0\0";
+      const size_t copy_header_size = 19;
+
+      bool is_supported(Oid type)
+      {
+        switch (type)
+        {
+          case type_oid::boolean:
+          case type_oid::bytea:
+          case type_oid::name:
+          case type_oid::int8:
+          case type_oid::int2:
+          case type_oid::int4:
+          case type_oid::text:
+          case type_oid::oid:
+          case type_oid::json:
+          case type_oid::float4:
+          case type_oid::float8:
+          case type_oid::bpchar:
+          case type_oid::varchar:
+          case type_oid::date:
+          case type_oid::timestamp:
+          case type_oid::timestamptz:
+          case type_oid::numeric:
+          case type_oid::uuid:
+          case type_oid::jsonb:
+            return true;
+          default:
+            return false;
+        }
+      }
+
+      bool is_text(Oid type)
+      {
+        return type == type_oid::text || type == type_oid::varchar || type == type_oid::bpchar ||
+               type == type_oid::name || type == type_oid::json;
+      }
+
+      template <typename T>
+      bool fits(int64_t value)
+      {
+        return value >= std::numeric_limits<T>::min() && value <= std::numeric_limits<T>::max();
+      }
+    }
+
+    copy_writer_t::copy_writer_t(detail::connection_handle& connection,
+                                 const std::string& command,
+                                 std::vector<Oid> types)
+        : _connection(&connection), _types(std::move(types)), _bufferSize(connection.config->copy_buffer_size)
+    {
+      for (size_t i = 0; i < _types.size(); ++i)
+      {
+        if (!is_supported(_types[i]))
+        {
+          throw sqlpp::exception("PostgreSQL error: COPY does not support column " + std::to_string(i + 1) +
+                                 " of type " + std::to_string(_types[i]));
+        }
+      }
+
+      if (connection.config->debug)
+      {
+        std::cerr << "PostgreSQL debug: executing: " << command << std::endl;
+      }
+      _trace = detail::start_trace(connection, command);
+      PGresult* res = PQexec(connection.native(), command.c_str());
+      if (PQresultStatus(res) != PGRES_COPY_IN)
+      {
+        detail::finish_trace(_trace, res);
+      }
+      Result result;
+      result = res;
+      if (result.status() != PGRES_COPY_IN)
+      {
+        throw sqlpp::exception("PostgreSQL error: " + command + " did not start a COPY");
+      }
+
+      _active = true;
+      _buffer.reserve(_bufferSize + 1024);
+      _buffer.append(copy_header, copy_header_size);
+    }
+
+    copy_writer_t::copy_writer_t(copy_writer_t&& other)
+        : _connection(other._connection),
+          _types(std::move(other._types)),
+          _buffer(std::move(other._buffer)),
+          _bufferSize(other._bufferSize),
+          _rowStart(other._rowStart),
+          _active(other._active),
+          _trace(std::move(other._trace))
+    {
+      other._active = false;
+    }
+
+    copy_writer_t& copy_writer_t::operator=(copy_writer_t&& other)
+    {
+      if (this != &other)
+      {
+        abort();
+        _connection = other._connection;
+        _types = std::move(other._types);
+        _buffer = std::move(other._buffer);
+        _bufferSize = other._bufferSize;
+        _rowStart = other._rowStart;
+        _active = other._active;
+        _trace = std::move(other._trace);
+        other._active = false;
+      }
+      return *this;
+    }
+
+    copy_writer_t::~copy_writer_t()
+    {
+      abort();
+    }
+
+    void copy_writer_t::abort() noexcept
+    {
+      if (_active)
+      {
+        _active = false;
+        PQputCopyEnd(_connection->native(), "COPY aborted by the client");
+        while (PGresult* pending = PQgetResult(_connection->native()))
+        {
+          // The error of the aborted COPY
+          detail::finish_trace(_trace, pending);
+          PQclear(pending);
+        }
+        detail::finish_trace(_trace, nullptr);
+      }
+    }
+
+    void copy_writer_t::flush()
+    {
+      if (!_buffer.empty())
+      {
+        if (PQputCopyData(_connection->native(), _buffer.data(), static_cast<int>(_buffer.size())) != 1)
+        {
+          throw sqlpp::exception("PostgreSQL error: could not send COPY data: " +
+                                 std::string(PQerrorMessage(_connection->native())));
+        }
+        _buffer.clear();
+      }
+    }
+
+    size_t copy_writer_t::finish()
+    {
+      if (!_active)
+      {
+        throw sqlpp::exception("PostgreSQL error: COPY already finished");
+      }
+
+      detail::append_int16(_buffer, -1);
+      flush();
+      _active = false;
+      if (PQputCopyEnd(_connection->native(), nullptr) != 1)
+      {
+        detail::finish_trace(_trace, nullptr);
+        throw sqlpp::exception("PostgreSQL error: could not end COPY: " +
+                               std::string(PQerrorMessage(_connection->native())));
+      }
+
+      PGresult* completion = PQgetResult(_connection->native());
+      detail::finish_trace(_trace, completion);
+      while (PGresult* pending = PQgetResult(_connection->native()))
+      {
+        PQclear(pending);
+      }
+      Result result;
+      result = completion;
+      return static_cast<size_t>(result.affected_rows());
+    }
+
+    [[noreturn]] void copy_writer_t::throw_type_error(size_t index, const char* value_type) const
+    {
+      throw sqlpp::exception("PostgreSQL error: cannot COPY " + std::string(value_type) + " value into column " +
+                             std::to_string(index + 1) + " of type " + std::to_string(_types[index]));
+    }
+
+    void copy_writer_t::_begin_row()
+    {
+      if (!_active)
+      {
+        throw sqlpp::exception("PostgreSQL error: COPY already finished");
+      }
+      if (_buffer.size() >= _bufferSize)
+      {
+        flush();
+      }
+      _rowStart = _buffer.size();
+      detail::append_int16(_buffer, static_cast<int16_t>(_types.size()));
+    }
+
+    void copy_writer_t::_discard_row()
+    {
+      _buffer.resize(_rowStart);
+    }
+
+    void copy_writer_t::_bind_null(size_t)
+    {
+      detail::append_int32(_buffer, -1);
+    }
+
+    void copy_writer_t::_bind_boolean_parameter(size_t index, const signed char* value, bool is_null)
+    {
+      if (is_null)
+        return _bind_null(index);
+
+      switch (_types[index])
+      {
+        case type_oid::boolean:
+          detail::append_int32(_buffer, 1);
+          _buffer.push_back(*value ? 1 : 0);
+          break;
+        default:
+        {
+          const int64_t integral = *value ? 1 : 0;
+          _bind_integral_parameter(index, &integral, false);
+        }
+      }
+    }
+
+    void copy_writer_t::_bind_integral_parameter(size_t index, const int64_t* value, bool is_null)
+    {
+      if (is_null)
+        return _bind_null(index);
+
+      switch (_types[index])
+      {
+        case type_oid::int2:
+          if (!fits<int16_t>(*value))
+            throw_type_error(index, "out of range integral");
+          detail::append_int32(_buffer, 2);
+          detail::append_int16(_buffer, static_cast<int16_t>(*value));
+          break;
+        case type_oid::int4:
+          if (!fits<int32_t>(*value))
+            throw_type_error(index, "out of range integral");
+          detail::append_int32(_buffer, 4);
+          detail::append_int32(_buffer, static_cast<int32_t>(*value));
+          break;
+        case type_oid::oid:
+          if (!fits<uint32_t>(*value))
+            throw_type_error(index, "out of range integral");
+          detail::append_int32(_buffer, 4);
+          detail::append_int32(_buffer, static_cast<int32_t>(static_cast<uint32_t>(*value)));
+          break;
+        case type_oid::int8:
+          detail::append_int32(_buffer, 8);
+          detail::append_int64(_buffer, *value);
+          break;
+        case type_oid::float4:
+          detail::append_int32(_buffer, 4);
+          detail::append_float4(_buffer, static_cast<float>(*value));
+          break;
+        case type_oid::float8:
+          detail::append_int32(_buffer, 8);
+          detail::append_float8(_buffer, static_cast<double>(*value));
+          break;
+        case type_oid::boolean:
+          detail::append_int32(_buffer, 1);
+          _buffer.push_back(*value ? 1 : 0);
+          break;
+        default:
+        {
+          if (!is_text(_types[index]) && _types[index] != type_oid::numeric)
+            throw_type_error(index, "integral");
+          const auto text = std::to_string(*value);
+          _bind_text_parameter(index, &text, false);
+        }
+      }
+    }
+
+    void copy_writer_t::_bind_floating_point_parameter(size_t index, const double* value, bool is_null)
+    {
+      if (is_null)
+        return _bind_null(index);
+
+      switch (_types[index])
+      {
+        case type_oid::float4:
+          detail::append_int32(_buffer, 4);
+          detail::append_float4(_buffer, static_cast<float>(*value));
+          break;
+        case type_oid::float8:
+          detail::append_int32(_buffer, 8);
+          detail::append_float8(_buffer, *value);
+          break;
+        default:
+        {
+          if (!is_text(_types[index]) && _types[index] != type_oid::numeric)
+            throw_type_error(index, "floating point");
+          char text[32];
+          const auto length = std::snprintf(text, sizeof(text), "%.17g", *value);
+          const std::string str(text, static_cast<size_t>(length));
+          _bind_text_parameter(index, &str, false);
+        }
+      }
+    }
+
+    void copy_writer_t::_bind_text_parameter(size_t index, const std::string* value, bool is_null)
+    {
+      if (is_null)
+        return _bind_null(index);
+
+      const auto type = _types[index];
+      const auto start = _buffer.size();
+      detail::append_int32(_buffer, 0);
+      bool valid = true;
+      switch (type)
+      {
+        case type_oid::numeric:
+          valid = detail::append_numeric(_buffer, value->data(), value->size());
+          break;
+        case type_oid::uuid:
+          valid = detail::append_uuid_bytes(_buffer, *value);
+          break;
+        case type_oid::jsonb:
+          // format version
+          _buffer.push_back(1);
+          _buffer.append(*value);
+          break;
+        case type_oid::bytea:
+          _buffer.append(*value);
+          break;
+        default:
+          valid = is_text(type);
+          if (valid)
+            _buffer.append(*value);
+      }
+      if (!valid)
+      {
+        _buffer.resize(start);
+        throw_type_error(index, "text");
+      }
+      detail::write_int32(&_buffer[start], static_cast<int32_t>(_buffer.size() - start - 4));
+    }
+
+    void copy_writer_t::_bind_date_parameter(size_t index, const ::sqlpp::chrono::day_point* value, bool is_null)
+    {
+      if (is_null)
+        return _bind_null(index);
+
+      const auto days = value->time_since_epoch().count();
+      switch (_types[index])
+      {
+        case type_oid::date:
+          detail::append_int32(_buffer, 4);
+          detail::append_int32(_buffer, static_cast<int32_t>(days - detail::pg_epoch_days));
+          break;
+        case type_oid::timestamp:
+        case type_oid::timestamptz:
+          detail::append_int32(_buffer, 8);
+          detail::append_int64(_buffer, (days - detail::pg_epoch_days) * 86400 * 1000000);
+          break;
+        default:
+          throw_type_error(index, "date");
+      }
+    }
+
+    void copy_writer_t::_bind_date_time_parameter(size_t index,
+                                                  const ::sqlpp::chrono::microsecond_point* value,
+                                                  bool is_null)
+    {
+      if (is_null)
+        return _bind_null(index);
+
+      // Like binary parameters, timestamps are taken as UTC
+      switch (_types[index])
+      {
+        case type_oid::timestamp:
+        case type_oid::timestamptz:
+          detail::append_int32(_buffer, 8);
+          detail::append_int64(_buffer, value->time_since_epoch().count() - detail::pg_epoch_microseconds);
+          break;
+        case type_oid::date:
+          detail::append_int32(_buffer, 4);
+          detail::append_int32(
+              _buffer, static_cast<int32_t>(::date::floor<::date::days>(*value).time_since_epoch().count() -
+                                            detail::pg_epoch_days));
+          break;
+        default:
+          throw_type_error(index, "date time");
+      }
+    }
+  }
+}
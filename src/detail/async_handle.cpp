@@ -0,0 +1,229 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "async_handle.h"
+
+#include <sqlpp11/exception.h>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#else
+#include <poll.h>
+#endif
+
+#ifdef SQLPP_DYNAMIC_LOADING
+#include <sqlpp11/postgresql/dynamic_libpq.h>
+#endif
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+#ifdef SQLPP_DYNAMIC_LOADING
+    using namespace dynamic;
+#endif
+
+    namespace detail
+    {
+      async_handle_t::async_handle_t(connection_handle& _connection) : statement_handle_t(_connection)
+      {
+      }
+
+      async_handle_t::~async_handle_t()
+      {
+        if (!done && valid)
+        {
+          cancel();
+        }
+        if (_first)
+        {
+          PQclear(_first);
+        }
+      }
+
+      void async_handle_t::start()
+      {
+        if (PQsetnonblocking(connection.native(), 1) != 0)
+        {
+          throw sqlpp::exception("PostgreSQL error: could not switch to nonblocking mode: " +
+                                 std::string(PQerrorMessage(connection.native())));
+        }
+      }
+
+      void async_handle_t::send(const std::string& stmt)
+      {
+        start();
+        trace = start_trace(connection, stmt);
+        sent(PQsendQuery(connection.native(), stmt.c_str()) == 1);
+      }
+
+      void async_handle_t::send(prepared_statement_handle_t& prepared)
+      {
+        start();
+        trace = start_trace(connection, prepared.statement(), prepared.metrics());
+        sent(prepared.send());
+      }
+
+      void async_handle_t::sent(bool success)
+      {
+        if (!success)
+        {
+          const std::string message = PQerrorMessage(connection.native());
+          finish_trace(trace, nullptr);
+          PQsetnonblocking(connection.native(), 0);
+          throw sqlpp::exception("PostgreSQL error: could not send statement: " + message);
+        }
+        valid = true;
+        poll();
+      }
+
+      int async_handle_t::socket() const
+      {
+        return PQsocket(connection.native());
+      }
+
+      bool async_handle_t::poll()
+      {
+        if (done)
+        {
+          return true;
+        }
+
+        if (!flushed)
+        {
+          // The server may be blocked writing to us until we read, which it must do before it reads the rest
+          if (!PQconsumeInput(connection.native()))
+          {
+            fail();
+          }
+          const auto pending = PQflush(connection.native());
+          if (pending < 0)
+          {
+            fail();
+          }
+          if (pending > 0)
+          {
+            return false;
+          }
+          flushed = true;
+        }
+
+        if (!PQconsumeInput(connection.native()))
+        {
+          fail();
+        }
+        while (!PQisBusy(connection.native()))
+        {
+          PGresult* next = PQgetResult(connection.native());
+          if (!next)
+          {
+            complete();
+            return true;
+          }
+          // Only single statements are sent, keep the first result
+          if (_first)
+          {
+            PQclear(next);
+          }
+          else
+          {
+            _first = next;
+          }
+        }
+        return false;
+      }
+
+      void async_handle_t::wait()
+      {
+        while (!poll())
+        {
+#ifdef _WIN32
+          WSAPOLLFD descriptor{};
+          descriptor.fd = static_cast<SOCKET>(socket());
+          descriptor.events = flushed ? POLLRDNORM : (POLLRDNORM | POLLWRNORM);
+          WSAPoll(&descriptor, 1, -1);
+#else
+          pollfd descriptor{};
+          descriptor.fd = socket();
+          descriptor.events = flushed ? POLLIN : (POLLIN | POLLOUT);
+          ::poll(&descriptor, 1, -1);
+#endif
+        }
+      }
+
+      void async_handle_t::complete()
+      {
+        done = true;
+        PQsetnonblocking(connection.native(), 0);
+        finish_trace(trace, _first);
+        if (!_first)
+        {
+          return;
+        }
+
+        PGresult* first = _first;
+        _first = nullptr;
+        try
+        {
+          result = first;
+        }
+        catch (...)
+        {
+          error = std::current_exception();
+        }
+      }
+
+      void async_handle_t::fail()
+      {
+        const std::string message = PQerrorMessage(connection.native());
+        finish_trace(trace, nullptr);
+        cancel();
+        throw sqlpp::exception("PostgreSQL error: asynchronous execution failed: " + message);
+      }
+
+      void async_handle_t::cancel() noexcept
+      {
+        done = true;
+        PGcancel* cancel = PQgetCancel(connection.native());
+        if (cancel)
+        {
+          char error[256];
+          PQcancel(cancel, error, sizeof(error));
+          PQfreeCancel(cancel);
+        }
+        PQsetnonblocking(connection.native(), 0);
+        while (PGresult* pending = PQgetResult(connection.native()))
+        {
+          // Usually the error of the canceled statement
+          finish_trace(trace, _first ? _first : pending);
+          PQclear(pending);
+        }
+        finish_trace(trace, _first);
+      }
+    }
+  }
+}
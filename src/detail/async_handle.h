@@ -0,0 +1,83 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_POSTGRESQL_ASYNC_HANDLE_H
+#define SQLPP_POSTGRESQL_ASYNC_HANDLE_H
+
+#include <exception>
+#include <memory>
+
+#include "prepared_statement_handle.h"
+#include "statement_trace.h"
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+    namespace detail
+    {
+      // Handle for a statement sent on a connection in nonblocking mode, the result is collected with poll() as it
+      // arrives on the socket
+      struct DLL_PUBLIC async_handle_t : public statement_handle_t
+      {
+        bool flushed{false};
+        bool done{false};
+        std::exception_ptr error;
+        // Started before the statement was sent, finished with its result
+        std::unique_ptr<deferred_trace_t> trace;
+
+        async_handle_t(detail::connection_handle& _connection);
+        async_handle_t(const async_handle_t&) = delete;
+        async_handle_t(async_handle_t&&) = delete;
+        async_handle_t& operator=(const async_handle_t&) = delete;
+        async_handle_t& operator=(async_handle_t&&) = delete;
+
+        virtual ~async_handle_t();
+
+        void send(const std::string& stmt);
+        void send(prepared_statement_handle_t& prepared);
+
+        int socket() const;
+        // Flushes the statement and reads the available input without blocking, true when the result is complete
+        bool poll();
+        // Blocks on the socket until the result is complete
+        void wait();
+
+      private:
+        PGresult* _first{nullptr};
+
+        void start();
+        void sent(bool success);
+        void complete();
+        [[noreturn]] void fail();
+        void cancel() noexcept;
+      };
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,451 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_POSTGRESQL_BINARY_FORMAT_H
+#define SQLPP_POSTGRESQL_BINARY_FORMAT_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <sqlpp11/postgresql/type_oid.h>
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+    namespace detail
+    {
+      // The binary format counts dates and timestamps from 2000-01-01, std::chrono::system_clock from 1970-01-01
+      constexpr int64_t pg_epoch_days = 10957;
+      constexpr int64_t pg_epoch_microseconds = pg_epoch_days * 86400 * 1000000;
+
+      // All binary values are sent in network byte order
+      inline uint16_t read_uint16(const char* data)
+      {
+        const auto p = reinterpret_cast<const unsigned char*>(data);
+        return static_cast<uint16_t>((p[0] << 8) | p[1]);
+      }
+
+      inline uint32_t read_uint32(const char* data)
+      {
+        const auto p = reinterpret_cast<const unsigned char*>(data);
+        return (static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16) |
+               (static_cast<uint32_t>(p[2]) << 8) | static_cast<uint32_t>(p[3]);
+      }
+
+      inline uint64_t read_uint64(const char* data)
+      {
+        return (static_cast<uint64_t>(read_uint32(data)) << 32) | read_uint32(data + 4);
+      }
+
+      inline int16_t read_int16(const char* data)
+      {
+        return static_cast<int16_t>(read_uint16(data));
+      }
+
+      inline int32_t read_int32(const char* data)
+      {
+        return static_cast<int32_t>(read_uint32(data));
+      }
+
+      inline int64_t read_int64(const char* data)
+      {
+        return static_cast<int64_t>(read_uint64(data));
+      }
+
+      inline float read_float4(const char* data)
+      {
+        const auto bits = read_uint32(data);
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+      }
+
+      inline double read_float8(const char* data)
+      {
+        const auto bits = read_uint64(data);
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+      }
+
+      inline void write_uint16(char* data, uint16_t value)
+      {
+        data[0] = static_cast<char>(value >> 8);
+        data[1] = static_cast<char>(value);
+      }
+
+      inline void write_uint32(char* data, uint32_t value)
+      {
+        data[0] = static_cast<char>(value >> 24);
+        data[1] = static_cast<char>(value >> 16);
+        data[2] = static_cast<char>(value >> 8);
+        data[3] = static_cast<char>(value);
+      }
+
+      inline void write_uint64(char* data, uint64_t value)
+      {
+        write_uint32(data, static_cast<uint32_t>(value >> 32));
+        write_uint32(data + 4, static_cast<uint32_t>(value));
+      }
+
+      inline void write_int32(char* data, int32_t value)
+      {
+        write_uint32(data, static_cast<uint32_t>(value));
+      }
+
+      inline void write_int64(char* data, int64_t value)
+      {
+        write_uint64(data, static_cast<uint64_t>(value));
+      }
+
+      inline void write_float8(char* data, double value)
+      {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        write_uint64(data, bits);
+      }
+
+      // Days since 1970-01-01 of a binary date. +/-infinity are sent as the limits of int32_t and kept, they are
+      // day_point::max() and min(). Finite dates end long before those.
+      inline int32_t read_date_days(const char* data)
+      {
+        const auto days = read_int32(data);
+        if (days == std::numeric_limits<int32_t>::max() || days == std::numeric_limits<int32_t>::min())
+        {
+          return days;
+        }
+        return static_cast<int32_t>(days + pg_epoch_days);
+      }
+
+      // Microseconds since 1970-01-01 of a binary date. Dates beyond the range of int64_t, +/-infinity among them, are
+      // clamped to microsecond_point::max() and min().
+      inline int64_t read_date_microseconds(const char* data)
+      {
+        constexpr int64_t day = INT64_C(86400) * 1000000;
+        const int64_t days = read_int32(data) + pg_epoch_days;
+        if (days > std::numeric_limits<int64_t>::max() / day)
+        {
+          return std::numeric_limits<int64_t>::max();
+        }
+        if (days < std::numeric_limits<int64_t>::min() / day)
+        {
+          return std::numeric_limits<int64_t>::min();
+        }
+        return days * day;
+      }
+
+      // Microseconds since 1970-01-01 of a binary timestamp, +/-infinity and the last finite timestamps are clamped
+      // to microsecond_point::max() and min()
+      inline int64_t read_timestamp_microseconds(const char* data)
+      {
+        const auto microseconds = read_int64(data);
+        if (microseconds > std::numeric_limits<int64_t>::max() - pg_epoch_microseconds)
+        {
+          return std::numeric_limits<int64_t>::max();
+        }
+        if (microseconds == std::numeric_limits<int64_t>::min())
+        {
+          return std::numeric_limits<int64_t>::min();
+        }
+        return microseconds + pg_epoch_microseconds;
+      }
+
+      // numeric is sent as a header of four int16 (ndigits, weight, sign, dscale) followed by ndigits base 10000
+      // digits, the first of which has the weight 10000^weight
+      constexpr uint16_t numeric_negative = 0x4000;
+
+      inline double read_numeric_as_double(const char* data)
+      {
+        const auto ndigits = read_int16(data);
+        const auto weight = read_int16(data + 2);
+        const auto sign = read_uint16(data + 4);
+        if (sign != 0 && sign != numeric_negative)
+        {
+          // NaN or (since PostgreSQL 14) +/- infinity
+          switch (sign)
+          {
+            case 0xD000:
+              return std::numeric_limits<double>::infinity();
+            case 0xF000:
+              return -std::numeric_limits<double>::infinity();
+            default:
+              return std::numeric_limits<double>::quiet_NaN();
+          }
+        }
+
+        double value = 0;
+        for (int i = 0; i < ndigits; ++i)
+        {
+          value = value * 10000 + read_int16(data + 8 + 2 * i);
+        }
+        value *= std::pow(10000.0, weight - ndigits + 1);
+        return sign == numeric_negative ? -value : value;
+      }
+
+      // Truncates towards zero, like the cast to an integer type would. Values beyond the range of int64_t, +/- infinity
+      // among them, are clamped to it, NaN is 0.
+      inline int64_t read_numeric_as_int64(const char* data)
+      {
+        const auto ndigits = read_int16(data);
+        const auto weight = read_int16(data + 2);
+        const auto sign = read_uint16(data + 4);
+        switch (sign)
+        {
+          case 0:
+          case numeric_negative:
+            break;
+          case 0xD000:
+            return std::numeric_limits<int64_t>::max();
+          case 0xF000:
+            return std::numeric_limits<int64_t>::min();
+          default:
+            return 0;
+        }
+
+        // Summed up as a negative number, which has the larger range
+        constexpr int64_t lowest = std::numeric_limits<int64_t>::min();
+        const int64_t overflow = sign == numeric_negative ? lowest : std::numeric_limits<int64_t>::max();
+        int64_t value = 0;
+        for (int i = 0; i <= weight; ++i)
+        {
+          const int64_t digit = i < ndigits ? read_int16(data + 8 + 2 * i) : 0;
+          if (value < (lowest + digit) / 10000)
+          {
+            return overflow;
+          }
+          value = value * 10000 - digit;
+        }
+        if (sign == numeric_negative)
+        {
+          return value;
+        }
+        return value == lowest ? overflow : -value;
+      }
+
+      inline void append_int16(std::string& out, int16_t value)
+      {
+        char data[2];
+        write_uint16(data, static_cast<uint16_t>(value));
+        out.append(data, sizeof(data));
+      }
+
+      inline void append_int32(std::string& out, int32_t value)
+      {
+        char data[4];
+        write_int32(data, value);
+        out.append(data, sizeof(data));
+      }
+
+      inline void append_int64(std::string& out, int64_t value)
+      {
+        char data[8];
+        write_int64(data, value);
+        out.append(data, sizeof(data));
+      }
+
+      inline void append_float4(std::string& out, float value)
+      {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        append_int32(out, static_cast<int32_t>(bits));
+      }
+
+      inline void append_float8(std::string& out, double value)
+      {
+        char data[8];
+        write_float8(data, value);
+        out.append(data, sizeof(data));
+      }
+
+      // Appends the binary numeric for a decimal number in text form ("-12.50", "1e+20", "NaN", "Infinity"). Returns
+      // false if the text is not a number.
+      inline bool append_numeric(std::string& out, const char* text, size_t length)
+      {
+        const char* pos = text;
+        const char* const end = text + length;
+        uint16_t sign = 0;
+        if (pos != end && (*pos == '-' || *pos == '+'))
+        {
+          sign = (*pos == '-') ? numeric_negative : 0;
+          ++pos;
+        }
+
+        const std::string rest(pos, end);
+        if (rest == "NaN" || rest == "nan" || rest == "inf" || rest == "Infinity")
+        {
+          append_int16(out, 0);
+          append_int16(out, 0);
+          append_int16(out, static_cast<int16_t>(rest[0] == 'N' || rest[0] == 'n'
+                                                     ? 0xC000
+                                                     : (sign == numeric_negative ? 0xF000 : 0xD000)));
+          append_int16(out, 0);
+          return true;
+        }
+
+        // All significant decimal digits, and the position of the decimal point relative to them
+        std::string digits;
+        int64_t point = -1;
+        for (; pos != end && *pos != 'e' && *pos != 'E'; ++pos)
+        {
+          if (*pos == '.' && point < 0)
+          {
+            point = static_cast<int64_t>(digits.size());
+          }
+          else if (*pos >= '0' && *pos <= '9')
+          {
+            digits.push_back(*pos);
+          }
+          else
+          {
+            return false;
+          }
+        }
+        if (digits.empty())
+        {
+          return false;
+        }
+        if (point < 0)
+        {
+          point = static_cast<int64_t>(digits.size());
+        }
+        if (pos != end)
+        {
+          char* exponent_end = nullptr;
+          const std::string exponent(pos + 1, end);
+          point += std::strtol(exponent.c_str(), &exponent_end, 10);
+          if (exponent.empty() || *exponent_end != '\0')
+          {
+            return false;
+          }
+        }
+        const auto dscale = std::max<int64_t>(0, static_cast<int64_t>(digits.size()) - point);
+
+        // Align the digits to groups of four around the decimal point
+        const auto lead = ((point % 4) + 4) % 4 == 0 ? 0 : 4 - ((point % 4) + 4) % 4;
+        digits.insert(0, static_cast<size_t>(lead), '0');
+        point += lead;
+        digits.append((4 - digits.size() % 4) % 4, '0');
+
+        std::vector<int16_t> groups;
+        for (size_t i = 0; i < digits.size(); i += 4)
+        {
+          groups.push_back(static_cast<int16_t>(std::stoi(digits.substr(i, 4))));
+        }
+        auto weight = point / 4 - 1;
+        size_t first = 0;
+        while (first < groups.size() && groups[first] == 0)
+        {
+          ++first;
+          --weight;
+        }
+        size_t last = groups.size();
+        while (last > first && groups[last - 1] == 0)
+        {
+          --last;
+        }
+        if (first == last)
+        {
+          // zero
+          weight = 0;
+          sign = 0;
+        }
+
+        append_int16(out, static_cast<int16_t>(last - first));
+        append_int16(out, static_cast<int16_t>(weight));
+        append_int16(out, static_cast<int16_t>(sign));
+        append_int16(out, static_cast<int16_t>(dscale));
+        for (size_t i = first; i < last; ++i)
+        {
+          append_int16(out, groups[i]);
+        }
+        return true;
+      }
+
+      // Appends the 16 bytes of a uuid in text form, with or without dashes. Returns false if it is not a uuid.
+      inline bool append_uuid_bytes(std::string& out, const std::string& text)
+      {
+        std::string bytes;
+        int high = -1;
+        for (const char c : text)
+        {
+          int nibble;
+          if (c >= '0' && c <= '9')
+            nibble = c - '0';
+          else if (c >= 'a' && c <= 'f')
+            nibble = c - 'a' + 10;
+          else if (c >= 'A' && c <= 'F')
+            nibble = c - 'A' + 10;
+          else if (c == '-' || c == '{' || c == '}')
+            continue;
+          else
+            return false;
+
+          if (high < 0)
+          {
+            high = nibble;
+          }
+          else
+          {
+            bytes.push_back(static_cast<char>((high << 4) | nibble));
+            high = -1;
+          }
+        }
+        if (bytes.size() != 16 || high >= 0)
+        {
+          return false;
+        }
+        out.append(bytes);
+        return true;
+      }
+
+      // Appends the canonical text representation of a binary uuid, e.g. a0eebc99-9c0b-4ef8-bb6d-6bb9bd380a11
+      inline void append_uuid(std::string& out, const char* data)
+      {
+        static constexpr char hex[] = "0123456789abcdef";
+        for (int i = 0; i < 16; ++i)
+        {
+          if (i == 4 || i == 6 || i == 8 || i == 10)
+          {
+            out.push_back('-');
+          }
+          const auto byte = static_cast<unsigned char>(data[i]);
+          out.push_back(hex[byte >> 4]);
+          out.push_back(hex[byte & 0x0f]);
+        }
+      }
+    }
+  }
+}
+
+#endif
@@ -26,6 +26,8 @@
  */
 
 #include "connection_handle.h"
+#include "prepared_statement_handle.h"
+#include "statement_trace.h"
 
 #include <sqlpp11/postgresql/connection_config.h>
 #include <sqlpp11/postgresql/exception.h>
@@ -47,6 +49,18 @@ namespace sqlpp
 
     namespace detail
     {
+      namespace
+      {
+        // Hands out a cached statement. Its last result is freed when it is released back to the cache, the cache
+        // sees it in use as long as the handed out pointer lives.
+        std::shared_ptr<prepared_statement_handle_t> lend(const std::shared_ptr<prepared_statement_handle_t>& statement)
+        {
+          auto owner = statement;
+          return std::shared_ptr<prepared_statement_handle_t>(
+              statement.get(), [owner](prepared_statement_handle_t* handle) { handle->clearResult(); });
+        }
+      }
+
       connection_handle::connection_handle(const std::shared_ptr<connection_config>& conf) : config(conf)
       {
 #ifdef SQLPP_DYNAMIC_LOADING
@@ -181,6 +195,11 @@ namespace sqlpp
           PQfinish(this->postgres);
           throw broken_connection(std::move(msg));
         }
+
+        if (config->metrics)
+        {
+          metrics.reset(new metrics_recorder_t);
+        }
       }
 
       connection_handle::~connection_handle()
@@ -191,6 +210,10 @@ namespace sqlpp
           std::cerr << "PostgreSQL debug: closing database connection." << std::endl;
         }
 
+        // Release the cached statements while the connection is still open
+        statement_cache_index.clear();
+        statement_cache.clear();
+
         // Close connection
         if (this->postgres)
         {
@@ -200,10 +223,113 @@ namespace sqlpp
 
       void connection_handle::deallocate_prepared_statement(const std::string& name)
       {
-         std::string cmd = "DEALLOCATE \"" + name + "\"";
-         PGresult* result = PQexec(postgres, cmd.c_str());
-         PQclear(result);
-         prepared_statement_names.erase(name);
+        // Destructors should not wait for the server, the name stays reserved until the statement is deallocated
+        pending_deallocations.push_back(name);
+      }
+
+      void connection_handle::flush_deallocations()
+      {
+        if (pending_deallocations.empty() || pending_deallocations.size() < config->deallocate_batch_size)
+        {
+          return;
+        }
+        // Only between transactions, a failure must not abort a transaction of the user. Not while the connection
+        // waits for results in nonblocking or pipeline mode either.
+        if (PQtransactionStatus(postgres) != PQTRANS_IDLE || PQisnonblocking(postgres))
+        {
+          return;
+        }
+#ifdef LIBPQ_HAS_PIPELINING
+        if (PQpipelineStatus(postgres) != PQ_PIPELINE_OFF)
+        {
+          return;
+        }
+#endif
+
+        std::string cmd;
+        for (const auto& name : pending_deallocations)
+        {
+          cmd.append("DEALLOCATE \"" + name + "\";");
+        }
+        if (deallocate(cmd, false))
+        {
+          for (const auto& name : pending_deallocations)
+          {
+            prepared_statement_names.erase(name);
+          }
+          pending_deallocations.clear();
+          return;
+        }
+
+        // The batch ran as one implicit transaction, so nothing was deallocated. Retry one by one, e.g. when a
+        // statement is already gone after DISCARD ALL.
+        std::vector<std::string> remaining;
+        for (const auto& name : pending_deallocations)
+        {
+          if (deallocate("DEALLOCATE \"" + name + "\"", true))
+          {
+            prepared_statement_names.erase(name);
+          }
+          else
+          {
+            remaining.push_back(name);
+          }
+        }
+        pending_deallocations.swap(remaining);
+      }
+
+      bool connection_handle::deallocate(const std::string& cmd, bool missing_is_done)
+      {
+        if (config->debug)
+        {
+          std::cerr << "PostgreSQL debug: executing: " << cmd << std::endl;
+        }
+        statement_trace_t trace(*this, cmd, statement_phase_t::execute,
+                                metrics ? metrics->entry_for_key("DEALLOCATE") : nullptr);
+        PGresult* result = PQexec(postgres, cmd.c_str());
+        trace.finish(result);
+        bool done = PQresultStatus(result) == PGRES_COMMAND_OK;
+        if (!done && result && missing_is_done)
+        {
+          // Gone already, e.g. after DISCARD ALL or DEALLOCATE ALL
+          const char* sqlstate = PQresultErrorField(result, PG_DIAG_SQLSTATE);
+          done = sqlstate && std::string(sqlstate) == "26000";
+        }
+        PQclear(result);
+        return done;
+      }
+
+      std::shared_ptr<prepared_statement_handle_t> connection_handle::cached_statement(const std::string& key)
+      {
+        const auto found = statement_cache_index.find(key);
+        // Only the cache refers to statements that are not in use
+        if (found == statement_cache_index.end() || found->second->second.use_count() != 1)
+        {
+          return nullptr;
+        }
+        statement_cache.splice(statement_cache.begin(), statement_cache, found->second);
+        return lend(found->second->second);
+      }
+
+      std::shared_ptr<prepared_statement_handle_t> connection_handle::cache_statement(
+          const std::string& key, const std::shared_ptr<prepared_statement_handle_t>& statement)
+      {
+        const auto found = statement_cache_index.find(key);
+        if (found != statement_cache_index.end())
+        {
+          // Replaces a statement that was in use, it is deallocated when it is released
+          statement_cache.erase(found->second);
+          statement_cache_index.erase(found);
+        }
+        statement_cache.emplace_front(key, statement);
+        statement_cache_index[key] = statement_cache.begin();
+
+        while (statement_cache.size() > config->statement_cache_size)
+        {
+          statement_cache_index.erase(statement_cache.back().first);
+          statement_cache.pop_back();
+        }
+        return lend(statement);
       }
     }
   }
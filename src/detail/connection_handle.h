@@ -28,13 +28,20 @@
 #ifndef SQLPP_POSTGRESQL_CONNECTION_HANDLE_H
 #define SQLPP_POSTGRESQL_CONNECTION_HANDLE_H
 
+#include <cstdint>
+#include <list>
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <libpq-fe.h>
 #include <sqlpp11/postgresql/visibility.h>
 
+#include "metrics_recorder.h"
+
 namespace sqlpp
 {
   namespace postgresql
@@ -44,11 +51,22 @@ namespace sqlpp
 
     namespace detail
     {
+      struct prepared_statement_handle_t;
+
       struct DLL_LOCAL connection_handle
       {
         const std::shared_ptr<connection_config> config;
         PGconn* postgres{nullptr};
 		std::set<std::string> prepared_statement_names;
+        // Released prepared statements that are not deallocated yet (see connection_config::deallocate_batch_size)
+        std::vector<std::string> pending_deallocations;
+        // Number of cursors declared so far, used for unique cursor names
+        uint64_t cursor_count{0};
+        // Prepared statements kept for reuse, most recently used first (see connection_config::statement_cache_size)
+        std::list<std::pair<std::string, std::shared_ptr<prepared_statement_handle_t>>> statement_cache;
+        std::unordered_map<std::string, decltype(statement_cache)::iterator> statement_cache_index;
+        // Only with connection_config::metrics
+        std::unique_ptr<metrics_recorder_t> metrics;
 
         connection_handle(const std::shared_ptr<connection_config>& config);
         ~connection_handle();
@@ -63,6 +81,18 @@ namespace sqlpp
         }
 
         void deallocate_prepared_statement(const std::string& name);
+        // Deallocates the released prepared statements in one round trip once there are enough of them, call before
+        // executing a statement
+        void flush_deallocations();
+        // Runs DEALLOCATE commands, returns whether the statements are gone. A statement that does not exist counts
+        // as gone if missing_is_done.
+        bool deallocate(const std::string& cmd, bool missing_is_done);
+
+        // Returns the cached statement for the key if it is not in use, nullptr otherwise. The result of a statement
+        // handed out by these is cleared when it is released.
+        std::shared_ptr<prepared_statement_handle_t> cached_statement(const std::string& key);
+        std::shared_ptr<prepared_statement_handle_t> cache_statement(
+            const std::string& key, const std::shared_ptr<prepared_statement_handle_t>& statement);
       };
     }
   }
@@ -0,0 +1,278 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "copy_out_handle.h"
+
+#include <sqlpp11/exception.h>
+
+#include <memory>
+
+#include "binary_format.h"
+
+#ifdef SQLPP_DYNAMIC_LOADING
+#include <sqlpp11/postgresql/dynamic_libpq.h>
+#endif
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+#ifdef SQLPP_DYNAMIC_LOADING
+    using namespace dynamic;
+#endif
+
+    namespace detail
+    {
+      namespace
+      {
+        // Signature and flags field of the binary COPY header, followed by the length of the header extension
+        const size_t copy_signature_size = 11;
+        const size_t copy_header_size = copy_signature_size + 4 + 4;
+
+        struct result_deleter
+        {
+          void operator()(PGresult* result) const
+          {
+            PQclear(result);
+          }
+        };
+
+        [[noreturn]] void throw_malformed()
+        {
+          throw sqlpp::exception("PostgreSQL error: malformed COPY data");
+        }
+      }
+
+      copy_out_handle_t::copy_out_handle_t(connection_handle& _connection, int chunkRows)
+          : statement_handle_t(_connection), _chunkRows(chunkRows)
+      {
+      }
+
+      copy_out_handle_t::~copy_out_handle_t()
+      {
+        if (!_finished)
+        {
+          cancel();
+        }
+      }
+
+      void copy_out_handle_t::start(const std::string& stmt)
+      {
+        describe(stmt);
+
+        const auto command = "COPY (" + stmt + ") TO STDOUT (FORMAT binary)";
+        if (debug())
+        {
+          std::cerr << "PostgreSQL debug: executing: " << command << std::endl;
+        }
+        _trace = start_trace(connection, command);
+        PGresult* res = PQexec(connection.native(), command.c_str());
+        if (PQresultStatus(res) != PGRES_COPY_OUT)
+        {
+          finish_trace(_trace, res);
+        }
+        Result copy;
+        copy = res;
+        if (copy.status() != PGRES_COPY_OUT)
+        {
+          throw sqlpp::exception("PostgreSQL error: " + command + " did not start a COPY");
+        }
+        _finished = false;
+        valid = true;
+      }
+
+      void copy_out_handle_t::describe(const std::string& stmt)
+      {
+        // The COPY data has no column types, take them from the description of the select
+        Result prepared;
+        prepared = PQprepare(connection.native(), "", stmt.c_str(), 0, nullptr);
+        PGresult* description = PQdescribePrepared(connection.native(), "");
+        Result owner;
+        owner = description;
+        for (int i = 0; i < owner.field_count(); ++i)
+        {
+          _names.emplace_back(PQfname(description, i));
+          _types.push_back(owner.field_type(i));
+        }
+      }
+
+      PGresult* copy_out_handle_t::make_chunk() const
+      {
+        std::unique_ptr<PGresult, result_deleter> chunk(PQmakeEmptyPGresult(connection.native(), PGRES_TUPLES_OK));
+        std::vector<PGresAttDesc> attributes(_types.size());
+        for (size_t i = 0; i < _types.size(); ++i)
+        {
+          attributes[i].name = const_cast<char*>(_names[i].c_str());
+          attributes[i].format = 1;
+          attributes[i].typid = _types[i];
+          attributes[i].typlen = -1;
+          attributes[i].atttypmod = -1;
+        }
+        if (!chunk || !PQsetResultAttrs(chunk.get(), static_cast<int>(attributes.size()), attributes.data()))
+        {
+          throw sqlpp::exception("PostgreSQL error: could not create result for COPY data");
+        }
+        return chunk.release();
+      }
+
+      bool copy_out_handle_t::fetch_next_result()
+      {
+        if (_finished)
+        {
+          return false;
+        }
+
+        clearResult();
+        std::unique_ptr<PGresult, result_deleter> chunk(make_chunk());
+        int rows = 0;
+        while (rows < _chunkRows && !_finished)
+        {
+          char* data = nullptr;
+          const int length = PQgetCopyData(connection.native(), &data, 0);
+          if (length < 0)
+          {
+            // -1: all data received, -2: error
+            finish();
+            if (length == -2)
+            {
+              throw sqlpp::exception("PostgreSQL error: could not read COPY data: " +
+                                     std::string(PQerrorMessage(connection.native())));
+            }
+            break;
+          }
+
+          std::unique_ptr<char, void (*)(void*)> owner(data, PQfreemem);
+          decode(data, data + length, chunk.get(), rows);
+        }
+
+        result = chunk.release();
+        return true;
+      }
+
+      void copy_out_handle_t::decode(const char* data, const char* end, PGresult* chunk, int& rows)
+      {
+        if (!_headerRead)
+        {
+          // The header is sent along with the first row
+          if (end - data < static_cast<std::ptrdiff_t>(copy_header_size) ||
+              std::memcmp(data, "PGCOPY\n\377\r\n\0", copy_signature_size) != 0)
+          {
+            throw_malformed();
+          }
+          const auto extension = read_uint32(data + copy_signature_size + 4);
+          if (static_cast<size_t>(end - data) < copy_header_size + extension)
+          {
+            throw_malformed();
+          }
+          data += copy_header_size + extension;
+          _headerRead = true;
+        }
+
+        while (data != end)
+        {
+          if (end - data < 2)
+          {
+            throw_malformed();
+          }
+          const auto fields = read_int16(data);
+          data += 2;
+          if (fields == -1)
+          {
+            // trailer, the end of the data follows
+            return;
+          }
+          if (static_cast<size_t>(fields) != _types.size())
+          {
+            throw_malformed();
+          }
+
+          for (int field = 0; field < fields; ++field)
+          {
+            if (end - data < 4)
+            {
+              throw_malformed();
+            }
+            const auto length = read_int32(data);
+            data += 4;
+            if (length > end - data)
+            {
+              throw_malformed();
+            }
+            if (!PQsetvalue(chunk, rows, field, length < 0 ? nullptr : const_cast<char*>(data), length))
+            {
+              throw sqlpp::exception("PostgreSQL error: could not store COPY data");
+            }
+            data += length < 0 ? 0 : length;
+          }
+          ++rows;
+        }
+      }
+
+      void copy_out_handle_t::finish()
+      {
+        _finished = true;
+        PGresult* completion = PQgetResult(connection.native());
+        finish_trace(_trace, completion);
+        while (PGresult* pending = PQgetResult(connection.native()))
+        {
+          PQclear(pending);
+        }
+        if (completion)
+        {
+          // Reports errors that happened while copying
+          Result check;
+          check = completion;
+        }
+      }
+
+      void copy_out_handle_t::cancel() noexcept
+      {
+        _finished = true;
+        PGcancel* cancel = PQgetCancel(connection.native());
+        if (cancel)
+        {
+          char error[256];
+          PQcancel(cancel, error, sizeof(error));
+          PQfreeCancel(cancel);
+        }
+
+        char* data = nullptr;
+        while (PQgetCopyData(connection.native(), &data, 0) >= 0)
+        {
+          PQfreemem(data);
+        }
+        while (PGresult* pending = PQgetResult(connection.native()))
+        {
+          // Usually the error of the canceled COPY
+          finish_trace(_trace, pending);
+          PQclear(pending);
+        }
+        finish_trace(_trace, nullptr);
+      }
+    }
+  }
+}
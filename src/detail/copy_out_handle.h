@@ -0,0 +1,77 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_POSTGRESQL_COPY_OUT_HANDLE_H
+#define SQLPP_POSTGRESQL_COPY_OUT_HANDLE_H
+
+#include <memory>
+
+#include "prepared_statement_handle.h"
+#include "statement_trace.h"
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+    namespace detail
+    {
+      // Handle for a select run as COPY (...) TO STDOUT (FORMAT binary). The rows are decoded from the COPY data in
+      // chunks of chunkRows rows into results in the binary format, so they are bound like binary_results.
+      struct DLL_PUBLIC copy_out_handle_t : public statement_handle_t
+      {
+        copy_out_handle_t(detail::connection_handle& _connection, int chunkRows);
+        copy_out_handle_t(const copy_out_handle_t&) = delete;
+        copy_out_handle_t(copy_out_handle_t&&) = delete;
+        copy_out_handle_t& operator=(const copy_out_handle_t&) = delete;
+        copy_out_handle_t& operator=(copy_out_handle_t&&) = delete;
+
+        virtual ~copy_out_handle_t();
+
+        void start(const std::string& stmt);
+
+        bool fetch_next_result() override;
+
+      private:
+        int _chunkRows;
+        std::vector<std::string> _names;
+        std::vector<Oid> _types;
+        bool _headerRead{false};
+        bool _finished{true};
+        // From starting the COPY to its completion
+        std::unique_ptr<deferred_trace_t> _trace;
+
+        void describe(const std::string& stmt);
+        PGresult* make_chunk() const;
+        void decode(const char* data, const char* end, PGresult* chunk, int& rows);
+        void finish();
+        void cancel() noexcept;
+      };
+    }
+  }
+}
+
+#endif
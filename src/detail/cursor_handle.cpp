@@ -0,0 +1,120 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cursor_handle.h"
+#include "statement_trace.h"
+
+#include <sqlpp11/postgresql/connection_config.h>
+
+#ifdef SQLPP_DYNAMIC_LOADING
+#include <sqlpp11/postgresql/dynamic_libpq.h>
+#endif
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+#ifdef SQLPP_DYNAMIC_LOADING
+    using namespace dynamic;
+#endif
+
+    namespace detail
+    {
+      cursor_handle_t::cursor_handle_t(connection_handle& _connection, std::string name, int fetchSize)
+          : statement_handle_t(_connection),
+            _name(std::move(name)),
+            _fetch("FETCH FORWARD " + std::to_string(fetchSize) + " FROM " + _name),
+            _fetchSize(fetchSize)
+      {
+      }
+
+      cursor_handle_t::~cursor_handle_t()
+      {
+        if (_open)
+        {
+          close();
+        }
+      }
+
+      void cursor_handle_t::declare(const std::string& stmt)
+      {
+        const auto declaration = "DECLARE " + _name + " NO SCROLL CURSOR FOR " + stmt;
+        if (debug())
+        {
+          std::cerr << "PostgreSQL debug: declaring cursor: " << declaration << std::endl;
+        }
+        if (connection.metrics)
+        {
+          _metrics = connection.metrics->entry(stmt);
+        }
+        statement_trace_t trace(connection, declaration, statement_phase_t::execute, _metrics);
+        PGresult* res = PQexec(connection.native(), declaration.c_str());
+        trace.finish(res);
+        result = res;
+        clearResult();
+        _open = true;
+        valid = true;
+      }
+
+      bool cursor_handle_t::fetch_next_result()
+      {
+        if (!_open)
+        {
+          return false;
+        }
+
+        if (debug())
+        {
+          std::cerr << "PostgreSQL debug: " << _fetch << std::endl;
+        }
+        clearResult();
+        const int resultFormat = connection.config->binary_results ? 1 : 0;
+        statement_trace_t trace(connection, _fetch, statement_phase_t::fetch, _metrics);
+        PGresult* res =
+            PQexecParams(connection.native(), _fetch.c_str(), 0, nullptr, nullptr, nullptr, nullptr, resultFormat);
+        trace.finish(res);
+        result = res;
+        if (result.records_size() < _fetchSize)
+        {
+          // Last batch, no need to keep the cursor around
+          close();
+        }
+        return true;
+      }
+
+      void cursor_handle_t::close()
+      {
+        _open = false;
+        // The cursor is gone already if the transaction ended, don't turn that into an error
+        if (PQtransactionStatus(connection.native()) == PQTRANS_INTRANS)
+        {
+          PQclear(PQexec(connection.native(), ("CLOSE " + _name).c_str()));
+        }
+      }
+    }
+  }
+}
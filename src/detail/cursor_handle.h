@@ -0,0 +1,69 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_POSTGRESQL_CURSOR_HANDLE_H
+#define SQLPP_POSTGRESQL_CURSOR_HANDLE_H
+
+#include "prepared_statement_handle.h"
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+    namespace detail
+    {
+      // Handle for a select declared as a cursor in the current transaction, its rows are read with FETCH in batches
+      // of fetchSize rows while iterating
+      struct DLL_PUBLIC cursor_handle_t : public statement_handle_t
+      {
+        cursor_handle_t(detail::connection_handle& _connection, std::string name, int fetchSize);
+        cursor_handle_t(const cursor_handle_t&) = delete;
+        cursor_handle_t(cursor_handle_t&&) = delete;
+        cursor_handle_t& operator=(const cursor_handle_t&) = delete;
+        cursor_handle_t& operator=(cursor_handle_t&&) = delete;
+
+        virtual ~cursor_handle_t();
+
+        void declare(const std::string& stmt);
+
+        bool fetch_next_result() override;
+
+      private:
+        std::string _name;
+        std::string _fetch;
+        int _fetchSize;
+        bool _open{false};
+        // The entry of the declared statement, only with connection_config::metrics
+        metrics_entry_t* _metrics{nullptr};
+
+        void close();
+      };
+    }
+  }
+}
+
+#endif
@@ -74,6 +74,7 @@ DYNDEFINE(PQgetisnull);
 DYNDEFINE(PQoidValue);
 DYNDEFINE(PQoidStatus);
 DYNDEFINE(PQfformat);
+DYNDEFINE(PQftype);
 DYNDEFINE(PQntuples);
 DYNDEFINE(PQnfields);
 DYNDEFINE(PQnparams);
@@ -82,6 +83,43 @@ DYNDEFINE(PQfinish);
 DYNDEFINE(PQstatus);
 DYNDEFINE(PQconnectdb);
 DYNDEFINE(PQerrorMessage);
+DYNDEFINE(PQsendQuery);
+DYNDEFINE(PQsendQueryPrepared);
+DYNDEFINE(PQsetSingleRowMode);
+DYNDEFINE(PQgetResult);
+DYNDEFINE(PQgetCancel);
+DYNDEFINE(PQcancel);
+DYNDEFINE(PQfreeCancel);
+#ifdef LIBPQ_HAS_CHUNK_MODE
+DYNDEFINE(PQsetChunkedRowsMode);
+#endif
+DYNDEFINE(PQtransactionStatus);
+DYNDEFINE(PQputCopyData);
+DYNDEFINE(PQputCopyEnd);
+DYNDEFINE(PQgetCopyData);
+DYNDEFINE(PQdescribePrepared);
+DYNDEFINE(PQfname);
+DYNDEFINE(PQmakeEmptyPGresult);
+DYNDEFINE(PQsetResultAttrs);
+DYNDEFINE(PQsetvalue);
+DYNDEFINE(PQsendQueryParams);
+#ifdef LIBPQ_HAS_PIPELINING
+DYNDEFINE(PQenterPipelineMode);
+DYNDEFINE(PQexitPipelineMode);
+DYNDEFINE(PQpipelineSync);
+DYNDEFINE(PQpipelineStatus);
+#endif
+DYNDEFINE(PQsetnonblocking);
+DYNDEFINE(PQisnonblocking);
+DYNDEFINE(PQsocket);
+DYNDEFINE(PQconsumeInput);
+DYNDEFINE(PQisBusy);
+DYNDEFINE(PQflush);
+#ifdef SQLPP_POSTGRESQL_HAS_RESULT_MEMORY_SIZE
+DYNDEFINE(PQresultMemorySize);
+#endif
+DYNDEFINE(PQnotifies);
+DYNDEFINE(PQescapeIdentifier);
 
 #undef DYNDEFINE
 
@@ -100,8 +138,12 @@ DYNDEFINE(PQerrorMessage);
 
 void init_pg(std::string libname)
 {
-   std::atomic<bool> initialized{false};
+   // Loaded once per process, later calls keep the functions (and any replaced by the caller) as they are
+   static std::atomic<bool> initialized{false};
+   static std::mutex loading;
 
+   if (initialized) return;
+   std::lock_guard<std::mutex> lock(loading);
    if (initialized) return;
 
    if (libname.empty())
@@ -155,6 +197,7 @@ void init_pg(std::string libname)
    DYNLOAD(handle, PQoidStatus);
    DYNLOAD(handle, PQoidValue);
    DYNLOAD(handle, PQfformat);
+   DYNLOAD(handle, PQftype);
    DYNLOAD(handle, PQntuples);
    DYNLOAD(handle, PQnfields);
    DYNLOAD(handle, PQnparams);
@@ -163,6 +206,43 @@ void init_pg(std::string libname)
    DYNLOAD(handle, PQconnectdb);
    DYNLOAD(handle, PQstatus);
    DYNLOAD(handle, PQerrorMessage);
+   DYNLOAD(handle, PQsendQuery);
+   DYNLOAD(handle, PQsendQueryPrepared);
+   DYNLOAD(handle, PQsetSingleRowMode);
+   DYNLOAD(handle, PQgetResult);
+   DYNLOAD(handle, PQgetCancel);
+   DYNLOAD(handle, PQcancel);
+   DYNLOAD(handle, PQfreeCancel);
+#ifdef LIBPQ_HAS_CHUNK_MODE
+   DYNLOAD(handle, PQsetChunkedRowsMode);
+#endif
+   DYNLOAD(handle, PQtransactionStatus);
+   DYNLOAD(handle, PQputCopyData);
+   DYNLOAD(handle, PQputCopyEnd);
+   DYNLOAD(handle, PQgetCopyData);
+   DYNLOAD(handle, PQdescribePrepared);
+   DYNLOAD(handle, PQfname);
+   DYNLOAD(handle, PQmakeEmptyPGresult);
+   DYNLOAD(handle, PQsetResultAttrs);
+   DYNLOAD(handle, PQsetvalue);
+   DYNLOAD(handle, PQsendQueryParams);
+#ifdef LIBPQ_HAS_PIPELINING
+   DYNLOAD(handle, PQenterPipelineMode);
+   DYNLOAD(handle, PQexitPipelineMode);
+   DYNLOAD(handle, PQpipelineSync);
+   DYNLOAD(handle, PQpipelineStatus);
+#endif
+   DYNLOAD(handle, PQsetnonblocking);
+   DYNLOAD(handle, PQisnonblocking);
+   DYNLOAD(handle, PQsocket);
+   DYNLOAD(handle, PQconsumeInput);
+   DYNLOAD(handle, PQisBusy);
+   DYNLOAD(handle, PQflush);
+#ifdef SQLPP_POSTGRESQL_HAS_RESULT_MEMORY_SIZE
+   DYNLOAD(handle, PQresultMemorySize);
+#endif
+   DYNLOAD(handle, PQnotifies);
+   DYNLOAD(handle, PQescapeIdentifier);
 
    if (PQescapeStringConn == nullptr || PQexec == nullptr)
    {
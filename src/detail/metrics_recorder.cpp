@@ -0,0 +1,351 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "metrics_recorder.h"
+
+#include <cctype>
+#include <cstdlib>
+
+#ifdef SQLPP_DYNAMIC_LOADING
+#include <sqlpp11/postgresql/dynamic_libpq.h>
+#endif
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+#ifdef SQLPP_DYNAMIC_LOADING
+    using namespace dynamic;
+#endif
+
+    namespace detail
+    {
+      namespace
+      {
+        bool is_identifier(char c)
+        {
+          return std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '$';
+        }
+
+        bool escape_string_start(const std::string& statement, size_t i)
+        {
+          return (statement[i] == 'E' || statement[i] == 'e') && i + 1 < statement.size() && statement[i + 1] == '\'';
+        }
+
+        // Appends a ? for a literal, unless it continues a list of literals: "(?, ?, ?)" becomes "(?)"
+        void append_literal(std::string& out)
+        {
+          auto end = out.size();
+          while (end && out[end - 1] == ' ')
+          {
+            --end;
+          }
+          if (end && out[end - 1] == ',')
+          {
+            --end;
+            while (end && out[end - 1] == ' ')
+            {
+              --end;
+            }
+            if (end && out[end - 1] == '?')
+            {
+              out.resize(end);
+              return;
+            }
+          }
+          out += '?';
+        }
+
+        // Writes the value to an atomic that no other thread writes
+        template <typename T>
+        void add(std::atomic<T>& counter, T value)
+        {
+          counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+      }  // namespace
+
+      std::string statement_fingerprint(const std::string& statement)
+      {
+        std::string out;
+        out.reserve(statement.size());
+        const auto size = statement.size();
+        size_t i = 0;
+        while (i < size)
+        {
+          const char c = statement[i];
+          const bool after_identifier = i > 0 && is_identifier(statement[i - 1]);
+          if (std::isspace(static_cast<unsigned char>(c)))
+          {
+            while (i < size && std::isspace(static_cast<unsigned char>(statement[i])))
+            {
+              ++i;
+            }
+            if (!out.empty())
+            {
+              out += ' ';
+            }
+          }
+          else if (c == '\'' || (escape_string_start(statement, i) && !after_identifier))
+          {
+            // String literal, '' is a quote, E'...' strings also have backslash escapes
+            const bool escapes = c != '\'';
+            i += escapes ? 2 : 1;
+            while (i < size)
+            {
+              if (escapes && statement[i] == '\\')
+              {
+                i += 2;
+              }
+              else if (statement[i] == '\'')
+              {
+                ++i;
+                if (i == size || statement[i] != '\'')
+                {
+                  break;
+                }
+                ++i;
+              }
+              else
+              {
+                ++i;
+              }
+            }
+            append_literal(out);
+          }
+          else if (std::isdigit(static_cast<unsigned char>(c)) && !after_identifier)
+          {
+            // Numeric literal, e.g. 42, 3.14 or 1e-5
+            while (i < size && (std::isdigit(static_cast<unsigned char>(statement[i])) || statement[i] == '.'))
+            {
+              ++i;
+            }
+            if (i < size && (statement[i] == 'e' || statement[i] == 'E'))
+            {
+              ++i;
+              if (i < size && (statement[i] == '+' || statement[i] == '-'))
+              {
+                ++i;
+              }
+              while (i < size && std::isdigit(static_cast<unsigned char>(statement[i])))
+              {
+                ++i;
+              }
+            }
+            append_literal(out);
+          }
+          else if (c == '"')
+          {
+            // Quoted identifier, kept as is
+            const auto end = statement.find('"', i + 1);
+            const auto length = (end == std::string::npos ? size : end + 1) - i;
+            out.append(statement, i, length);
+            i += length;
+          }
+          else
+          {
+            out += c;
+            ++i;
+          }
+        }
+        while (!out.empty() && (out.back() == ' ' || out.back() == ';'))
+        {
+          out.pop_back();
+        }
+        return out;
+      }
+
+      std::size_t result_memory_size(const PGresult* result)
+      {
+#ifdef SQLPP_POSTGRESQL_HAS_RESULT_MEMORY_SIZE
+#ifdef SQLPP_DYNAMIC_LOADING
+        // The loaded library can be older than the headers
+        if (!PQresultMemorySize)
+        {
+          return 0;
+        }
+#endif
+        return PQresultMemorySize(result);
+#else
+        (void)result;
+        return 0;
+#endif
+      }
+
+      void metrics_entry_t::record(statement_phase_t phase, std::chrono::nanoseconds duration, const PGresult* result)
+      {
+        auto& histogram = histograms[static_cast<size_t>(phase)];
+        add(histogram.buckets[latency_histogram_t::bucket_of(duration)], uint64_t{1});
+        add(histogram.count, uint64_t{1});
+        add(histogram.total, static_cast<int64_t>(duration.count()));
+
+        if (!result)
+        {
+          record_error(nullptr);
+          return;
+        }
+        switch (PQresultStatus(result))
+        {
+          case PGRES_BAD_RESPONSE:
+          case PGRES_NONFATAL_ERROR:
+          case PGRES_FATAL_ERROR:
+            record_error(result);
+            return;
+          default:
+            break;
+        }
+        if (PQnfields(result) > 0)
+        {
+          add(rows, static_cast<uint64_t>(PQntuples(result)));
+        }
+        else
+        {
+          // Empty for commands that do not affect rows
+          const char* affected = PQcmdTuples(const_cast<PGresult*>(result));
+          add(affected_rows, static_cast<uint64_t>(std::strtoul(affected, nullptr, 10)));
+        }
+        add(result_bytes, static_cast<uint64_t>(result_memory_size(result)));
+      }
+
+      void metrics_entry_t::record_rows(const PGresult* result)
+      {
+        add(rows, static_cast<uint64_t>(PQntuples(result)));
+        add(result_bytes, static_cast<uint64_t>(result_memory_size(result)));
+      }
+
+      void metrics_entry_t::record_error(const PGresult* result)
+      {
+        const char* sqlstate = result ? PQresultErrorField(result, PG_DIAG_SQLSTATE) : nullptr;
+        uint32_t error_class = 1u << 16;
+        if (sqlstate && sqlstate[0] && sqlstate[1])
+        {
+          error_class |= static_cast<uint32_t>(static_cast<unsigned char>(sqlstate[0])) << 8 |
+                         static_cast<unsigned char>(sqlstate[1]);
+        }
+
+        for (size_t slot = 0; slot < error_slots; ++slot)
+        {
+          const auto current = error_classes[slot].load(std::memory_order_relaxed);
+          if (current == error_class)
+          {
+            add(error_counts[slot], uint64_t{1});
+            return;
+          }
+          if (current == 0)
+          {
+            // The count is in place before the class is published
+            error_counts[slot].store(1, std::memory_order_relaxed);
+            error_classes[slot].store(error_class, std::memory_order_release);
+            return;
+          }
+        }
+        add(other_errors, uint64_t{1});
+      }
+
+      void metrics_entry_t::add_to(statement_metrics_t& metrics) const
+      {
+        latency_histogram_t* const targets[] = {&metrics.prepare, &metrics.execute, &metrics.fetch};
+        for (size_t phase = 0; phase < histograms.size(); ++phase)
+        {
+          latency_histogram_t histogram;
+          for (size_t bucket = 0; bucket < latency_histogram_t::bucket_count; ++bucket)
+          {
+            histogram.buckets[bucket] = histograms[phase].buckets[bucket].load(std::memory_order_relaxed);
+          }
+          histogram.count = histograms[phase].count.load(std::memory_order_relaxed);
+          histogram.total = std::chrono::nanoseconds(histograms[phase].total.load(std::memory_order_relaxed));
+          targets[phase]->merge(histogram);
+        }
+        metrics.rows += rows.load(std::memory_order_relaxed);
+        metrics.affected_rows += affected_rows.load(std::memory_order_relaxed);
+        metrics.result_bytes += result_bytes.load(std::memory_order_relaxed);
+        for (size_t slot = 0; slot < error_slots; ++slot)
+        {
+          const auto error_class = error_classes[slot].load(std::memory_order_acquire);
+          if (error_class == 0)
+          {
+            break;
+          }
+          std::string key;
+          if (error_class != 1u << 16)
+          {
+            key += static_cast<char>((error_class >> 8) & 0xff);
+            key += static_cast<char>(error_class & 0xff);
+          }
+          metrics.errors[key] += error_counts[slot].load(std::memory_order_relaxed);
+        }
+        const auto other = other_errors.load(std::memory_order_relaxed);
+        if (other)
+        {
+          metrics.errors["other"] += other;
+        }
+      }
+
+      metrics_recorder_t::~metrics_recorder_t()
+      {
+        auto entry = _head.load(std::memory_order_relaxed);
+        while (entry)
+        {
+          const auto next = entry->next;
+          delete entry;
+          entry = next;
+        }
+      }
+
+      metrics_entry_t* metrics_recorder_t::entry(const std::string& statement)
+      {
+        return entry_for_key(statement_fingerprint(statement));
+      }
+
+      metrics_entry_t* metrics_recorder_t::entry_for_key(const std::string& key)
+      {
+        const auto found = _index.find(key);
+        if (found != _index.end())
+        {
+          return found->second;
+        }
+        if (_index.size() >= max_statements && key != "(other)")
+        {
+          return entry_for_key("(other)");
+        }
+        const auto entry = new metrics_entry_t(key, _head.load(std::memory_order_relaxed));
+        _head.store(entry, std::memory_order_release);
+        _index.emplace(key, entry);
+        return entry;
+      }
+
+      metrics_snapshot_t metrics_recorder_t::snapshot() const
+      {
+        metrics_snapshot_t snapshot;
+        for (auto entry = _head.load(std::memory_order_acquire); entry; entry = entry->next)
+        {
+          entry->add_to(snapshot.statements[entry->fingerprint]);
+        }
+        return snapshot;
+      }
+    }  // namespace detail
+  }  // namespace postgresql
+}  // namespace sqlpp
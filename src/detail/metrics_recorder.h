@@ -0,0 +1,130 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_POSTGRESQL_METRICS_RECORDER_H
+#define SQLPP_POSTGRESQL_METRICS_RECORDER_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <libpq-fe.h>
+#include <sqlpp11/postgresql/metrics.h>
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+    namespace detail
+    {
+      enum class statement_phase_t
+      {
+        prepare,
+        execute,
+        fetch
+      };
+
+      // The text of the statement with literals replaced by ?, lists of them collapsed and whitespace normalized
+      std::string statement_fingerprint(const std::string& statement);
+
+      // PQresultMemorySize(), or 0 if libpq is older than 12
+      std::size_t result_memory_size(const PGresult* result);
+
+      // The counters of one statement. Only the thread using the connection writes them, so plain loads and stores
+      // suffice; they are atomic for snapshots taken from other threads.
+      struct metrics_entry_t
+      {
+        struct histogram_t
+        {
+          std::array<std::atomic<uint64_t>, latency_histogram_t::bucket_count> buckets{};
+          std::atomic<uint64_t> count{0};
+          std::atomic<int64_t> total{0};
+        };
+
+        // Number of different SQLSTATE classes counted per statement, further classes are counted as "other"
+        static constexpr std::size_t error_slots = 8;
+
+        const std::string fingerprint;
+        // Entries form a list that is only ever prepended to, this is fixed before an entry is published
+        metrics_entry_t* const next;
+
+        std::array<histogram_t, 3> histograms;
+        std::atomic<uint64_t> rows{0};
+        std::atomic<uint64_t> affected_rows{0};
+        std::atomic<uint64_t> result_bytes{0};
+        // The two characters of the class plus 1 << 16, 0 for a free slot
+        std::array<std::atomic<uint32_t>, error_slots> error_classes{};
+        std::array<std::atomic<uint64_t>, error_slots> error_counts{};
+        std::atomic<uint64_t> other_errors{0};
+
+        metrics_entry_t(std::string fingerprint, metrics_entry_t* next)
+            : fingerprint(std::move(fingerprint)), next(next)
+        {
+        }
+
+        void record(statement_phase_t phase, std::chrono::nanoseconds duration, const PGresult* result);
+        // The rows of a partial result, e.g. a single row of a streamed query. The final result is passed to record().
+        void record_rows(const PGresult* result);
+        void add_to(statement_metrics_t& metrics) const;
+
+      private:
+        void record_error(const PGresult* result);
+      };
+
+      // Per connection metrics (see connection_config::metrics)
+      class metrics_recorder_t
+      {
+        std::atomic<metrics_entry_t*> _head{nullptr};
+        // Only used by the thread using the connection
+        std::unordered_map<std::string, metrics_entry_t*> _index;
+
+      public:
+        // Bounds the memory for applications that build many different statements, e.g. with identifiers in them
+        static constexpr std::size_t max_statements = 1024;
+
+        metrics_recorder_t() = default;
+        metrics_recorder_t(const metrics_recorder_t&) = delete;
+        metrics_recorder_t& operator=(const metrics_recorder_t&) = delete;
+        ~metrics_recorder_t();
+
+        // The entry for the statement, by its fingerprint
+        metrics_entry_t* entry(const std::string& statement);
+        // The entry for a fixed key, e.g. for statements the library runs itself
+        metrics_entry_t* entry_for_key(const std::string& key);
+
+        metrics_snapshot_t snapshot() const;
+      };
+    }  // namespace detail
+  }  // namespace postgresql
+}  // namespace sqlpp
+
+#endif
@@ -0,0 +1,83 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_POSTGRESQL_PIPELINE_HANDLE_H
+#define SQLPP_POSTGRESQL_PIPELINE_HANDLE_H
+
+#include <deque>
+#include <exception>
+#include <memory>
+
+#include "prepared_statement_handle.h"
+#include "statement_trace.h"
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+    namespace detail
+    {
+      // Result of one statement in a pipeline, filled in when the pipeline reads it
+      struct DLL_PUBLIC pipeline_handle_t : public statement_handle_t
+      {
+        bool ready{false};
+        std::exception_ptr error;
+        // Started before the statement was sent, finished when the pipeline reads its result
+        std::unique_ptr<deferred_trace_t> trace;
+
+        pipeline_handle_t(detail::connection_handle& _connection) : statement_handle_t(_connection)
+        {
+        }
+      };
+
+      struct DLL_LOCAL pipeline_state_t
+      {
+        connection_handle& connection;
+        // Statements sent, in order, whose results were not read yet
+        std::deque<std::shared_ptr<pipeline_handle_t>> pending;
+        size_t syncs{0};
+        bool synced{true};
+        bool active{false};
+
+        pipeline_state_t(connection_handle& _connection);
+
+        void enter();
+        std::shared_ptr<pipeline_handle_t> send(const std::string& stmt);
+        std::shared_ptr<pipeline_handle_t> send(prepared_statement_handle_t& prepared);
+        void sync();
+        void wait_for(const pipeline_handle_t& handle);
+        void finish();
+
+      private:
+        std::shared_ptr<pipeline_handle_t> sent(bool success, std::unique_ptr<deferred_trace_t> trace);
+        void read_next();
+      };
+    }
+  }
+}
+
+#endif
@@ -1,4 +1,5 @@
 #include "prepared_statement_handle.h"
+#include "statement_trace.h"
 #include <algorithm>
 #include <random>
 #include <sqlpp11/postgresql/connection_config.h>
@@ -47,11 +48,28 @@ namespace sqlpp
 
       prepared_statement_handle_t::prepared_statement_handle_t(connection_handle& _connection,
                                                                std::string stmt,
-                                                               const size_t& paramCount)
-          : statement_handle_t(_connection), nullValues(paramCount), paramValues(paramCount)
+                                                               const size_t& paramCount,
+                                                               std::vector<Oid> types)
+          : statement_handle_t(_connection),
+            nullValues(paramCount),
+            paramValues(paramCount),
+            paramTypes(std::move(types)),
+            paramLengths(paramCount),
+            paramFormats(paramCount),
+            paramPointers(paramCount)
       {
+        if (!paramTypes.empty() && paramTypes.size() != paramCount)
+        {
+          // e.g. parameters in dynamic parts of the statement, let the server figure them out
+          paramTypes.clear();
+        }
+        _statement = std::move(stmt);
+        if (connection.metrics)
+        {
+          _metrics = connection.metrics->entry(_statement);
+        }
         generate_name();
-        prepare(std::move(stmt));
+        prepare();
       }
 
       prepared_statement_handle_t::~prepared_statement_handle_t()
@@ -64,22 +82,41 @@ namespace sqlpp
 
       void prepared_statement_handle_t::execute()
       {
-        int size = static_cast<int>(paramValues.size());
-
-        std::vector<const char*> values;
-        for (int i = 0; i < size; i++)
-          values.push_back(nullValues[i] ? nullptr : const_cast<char*>(paramValues[i].c_str()));
+        const auto values = parameter_values();
 
         // Execute prepared statement with the parameters.
         clearResult();
         valid = false;
         count = 0;
         totalCount = 0;
-        result = PQexecPrepared(connection.postgres, _name.data(), size, values.data(), nullptr, nullptr, 0);
+        statement_trace_t trace(connection, _statement, statement_phase_t::execute, _metrics);
+        PGresult* res = PQexecPrepared(connection.postgres, _name.data(), static_cast<int>(paramPointers.size()),
+                                       values, paramLengths.data(), paramFormats.data(), result_format());
+        trace.finish(res);
+        result = res;
 		/// @todo validate result? is it really valid
         valid = true;
       }
 
+      bool prepared_statement_handle_t::send()
+      {
+        const auto values = parameter_values();
+        return PQsendQueryPrepared(connection.postgres, _name.data(), static_cast<int>(paramPointers.size()), values,
+                                   paramLengths.data(), paramFormats.data(), result_format()) == 1;
+      }
+
+      const char* const* prepared_statement_handle_t::parameter_values()
+      {
+        for (size_t i = 0; i < paramValues.size(); i++)
+          paramPointers[i] = nullValues[i] ? nullptr : paramValues[i].c_str();
+        return paramPointers.data();
+      }
+
+      int prepared_statement_handle_t::result_format() const
+      {
+        return connection.config->binary_results ? 1 : 0;
+      }
+
       void prepared_statement_handle_t::generate_name()
       {
         // Generate a random name for the prepared statement
@@ -96,10 +133,15 @@ namespace sqlpp
         connection.prepared_statement_names.insert(_name);
       }
 
-      void prepared_statement_handle_t::prepare(std::string stmt)
+      void prepared_statement_handle_t::prepare()
       {
         // Create the prepared statement
-        result = PQprepare(connection.postgres, _name.c_str(), stmt.c_str(), 0, nullptr);
+        statement_trace_t trace(connection, _statement, statement_phase_t::prepare, _metrics);
+        const auto types = paramTypes.empty() ? nullptr : paramTypes.data();
+        PGresult* res = PQprepare(connection.postgres, _name.c_str(), _statement.c_str(),
+                                  static_cast<int>(paramTypes.size()), types);
+        trace.finish(res);
+        result = res;
         valid = true;
       }
     }
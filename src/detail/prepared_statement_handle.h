@@ -35,6 +35,7 @@
 
 #include <libpq-fe.h>
 #include <sqlpp11/postgresql/result.h>
+#include <sqlpp11/postgresql/type_oid.h>
 #include <sqlpp11/postgresql/visibility.h>
 
 #include "connection_handle.h"
@@ -60,6 +61,8 @@ namespace sqlpp
         uint32_t count{0};
         uint32_t totalCount = {0};
         uint32_t fields = {0};
+        // Text representation of the current binary value, for values that have no binary binding
+        std::string binaryText;
 
         // ctor
         statement_handle_t(detail::connection_handle& _connection);
@@ -72,6 +75,12 @@ namespace sqlpp
         bool operator!() const;
         void clearResult();
 
+        // Replaces an exhausted result with the next rows of the query, if any (see stream_handle_t)
+        virtual bool fetch_next_result()
+        {
+          return false;
+        }
+
         bool debug() const;
       };
 
@@ -79,14 +88,27 @@ namespace sqlpp
       {
       private:
         std::string _name{"xxxxxx"};
+        // The text it was prepared with, for the tracer
+        std::string _statement;
+        // Looked up once, only with connection_config::metrics
+        metrics_entry_t* _metrics{nullptr};
 
       public:
         // Store prepared statement arguments
         std::vector<bool> nullValues;
         std::vector<std::string> paramValues;
+        // Parameters typed here are sent in the binary format, the others as text
+        std::vector<Oid> paramTypes;
+        std::vector<int> paramLengths;
+        std::vector<int> paramFormats;
+        // Pointers handed to libpq, refreshed in place before each execution
+        std::vector<const char*> paramPointers;
 
         // ctor
-        prepared_statement_handle_t(detail::connection_handle& _connection, std::string stmt, const size_t& paramCount);
+        prepared_statement_handle_t(detail::connection_handle& _connection,
+                                    std::string stmt,
+                                    const size_t& paramCount,
+                                    std::vector<Oid> types = {});
         prepared_statement_handle_t(const prepared_statement_handle_t&) = delete;
         prepared_statement_handle_t(prepared_statement_handle_t&&) = default;
         prepared_statement_handle_t& operator=(const prepared_statement_handle_t&) = delete;
@@ -95,15 +117,44 @@ namespace sqlpp
         virtual ~prepared_statement_handle_t();
 
         void execute();
+        // Sends the execution without waiting for the result (see stream_handle_t)
+        bool send();
 
         std::string name() const
         {
           return _name;
         }
 
+        // The text it was prepared with and its metrics, for tracing it when it is sent
+        const std::string& statement() const
+        {
+          return _statement;
+        }
+
+        metrics_entry_t* metrics() const
+        {
+          return _metrics;
+        }
+
+        bool is_binary_parameter(size_t index) const
+        {
+          return !paramTypes.empty() && paramTypes[index] != type_oid::unspecified;
+        }
+
+        // Resizes the value of a binary parameter to its fixed width and returns where to write it
+        char* binary_parameter(size_t index, int length)
+        {
+          paramValues[index].resize(static_cast<size_t>(length));
+          paramLengths[index] = length;
+          paramFormats[index] = 1;
+          return &paramValues[index][0];
+        }
+
       private:
+        const char* const* parameter_values();
+        int result_format() const;
         void generate_name();
-        void prepare(std::string stmt);
+        void prepare();
       };
     }
   }
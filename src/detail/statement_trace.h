@@ -0,0 +1,218 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_POSTGRESQL_STATEMENT_TRACE_H
+#define SQLPP_POSTGRESQL_STATEMENT_TRACE_H
+
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+#include <libpq-fe.h>
+#include <sqlpp11/postgresql/connection_config.h>
+#include <sqlpp11/postgresql/tracer.h>
+
+#include "connection_handle.h"
+
+#ifdef SQLPP_DYNAMIC_LOADING
+#include <sqlpp11/postgresql/dynamic_libpq.h>
+#endif
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+#ifdef SQLPP_DYNAMIC_LOADING
+    using namespace dynamic;
+#endif
+    namespace detail
+    {
+      // Reports one statement to the tracer and the metrics of the connection, e.g.
+      //   statement_trace_t trace(connection, stmt);
+      //   PGresult* result = PQexec(connection.native(), stmt.c_str());
+      //   trace.finish(result);
+      // Without a tracer and metrics this is a null check at either end.
+      class statement_trace_t
+      {
+        tracer_t* const _tracer;
+        PGconn* const _connection;
+        const std::string& _statement;
+        const statement_phase_t _phase;
+        metrics_entry_t* _metrics{nullptr};
+        std::chrono::steady_clock::time_point _start;
+        // Of partial results, see partial()
+        std::size_t _rows{0};
+        std::size_t _bytes{0};
+
+      public:
+        // The metrics are recorded for the fingerprint of the statement unless an entry is given, e.g. one looked up
+        // once for a prepared statement
+        statement_trace_t(const connection_handle& connection,
+                          const std::string& statement,
+                          statement_phase_t phase = statement_phase_t::execute,
+                          metrics_entry_t* entry = nullptr)
+            : _tracer(connection.config->tracer.get()),
+              _connection(connection.native()),
+              _statement(statement),
+              _phase(phase)
+        {
+          if (connection.metrics)
+          {
+            _metrics = entry ? entry : connection.metrics->entry(statement);
+          }
+          if (_tracer)
+          {
+            _tracer->statement_start(_statement);
+          }
+          if (_tracer || _metrics)
+          {
+            _start = std::chrono::steady_clock::now();
+          }
+        }
+
+        // Counts the rows of a partial result, e.g. a single row of a streamed query. finish() takes the final result.
+        void partial(const PGresult* result)
+        {
+          if (_metrics)
+          {
+            _metrics->record_rows(result);
+          }
+          if (_tracer)
+          {
+            _rows += static_cast<std::size_t>(PQntuples(result));
+            _bytes += result_memory_size(result);
+          }
+        }
+
+        void finish(const PGresult* result)
+        {
+          if (!_tracer && !_metrics)
+          {
+            return;
+          }
+
+          const auto duration = std::chrono::steady_clock::now() - _start;
+          if (_metrics)
+          {
+            _metrics->record(_phase, duration, result);
+          }
+          if (!_tracer)
+          {
+            return;
+          }
+
+          if (!result)
+          {
+            // Out of memory or the connection is gone
+            _tracer->statement_error(_statement, duration, PQerrorMessage(_connection));
+            return;
+          }
+          switch (PQresultStatus(result))
+          {
+            case PGRES_BAD_RESPONSE:
+            case PGRES_NONFATAL_ERROR:
+            case PGRES_FATAL_ERROR:
+              _tracer->statement_error(_statement, duration, PQresultErrorMessage(result));
+              return;
+            default:
+              break;
+          }
+
+          statement_stats_t stats{duration, _rows, _bytes + result_memory_size(result)};
+          if (PQnfields(result) > 0)
+          {
+            stats.rows += static_cast<std::size_t>(PQntuples(result));
+          }
+          else
+          {
+            // Empty for commands that do not affect rows
+            const char* affected = PQcmdTuples(const_cast<PGresult*>(result));
+            stats.rows = static_cast<std::size_t>(std::strtoul(affected, nullptr, 10));
+          }
+          _tracer->statement_end(_statement, stats);
+        }
+      };
+
+      // Traces a statement whose results are read after the call that sent it returned, e.g. a streamed query. Keeps
+      // its own copy of the statement.
+      class deferred_trace_t
+      {
+        const std::string _statement;
+        statement_trace_t _trace;
+
+      public:
+        deferred_trace_t(const connection_handle& connection, std::string statement, metrics_entry_t* entry)
+            : _statement(std::move(statement)), _trace(connection, _statement, statement_phase_t::execute, entry)
+        {
+        }
+
+        void partial(const PGresult* result)
+        {
+          _trace.partial(result);
+        }
+
+        void finish(const PGresult* result)
+        {
+          _trace.finish(result);
+        }
+      };
+
+      // Starts tracing a statement that is about to be sent, nullptr without a tracer and metrics
+      inline std::unique_ptr<deferred_trace_t> start_trace(const connection_handle& connection,
+                                                           const std::string& statement,
+                                                           metrics_entry_t* entry = nullptr)
+      {
+        if (!connection.config->tracer && !connection.metrics)
+        {
+          return nullptr;
+        }
+        return std::unique_ptr<deferred_trace_t>(new deferred_trace_t(connection, statement, entry));
+      }
+
+      inline void trace_partial(const std::unique_ptr<deferred_trace_t>& trace, const PGresult* result)
+      {
+        if (trace)
+        {
+          trace->partial(result);
+        }
+      }
+
+      // Reports the end of the statement, later calls do nothing. A null result reports the error of the connection.
+      inline void finish_trace(std::unique_ptr<deferred_trace_t>& trace, const PGresult* result)
+      {
+        if (trace)
+        {
+          trace->finish(result);
+          trace.reset();
+        }
+      }
+    }  // namespace detail
+  }  // namespace postgresql
+}  // namespace sqlpp
+
+#endif
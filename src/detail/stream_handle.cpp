@@ -0,0 +1,155 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "stream_handle.h"
+
+#include <sqlpp11/exception.h>
+
+#ifdef SQLPP_DYNAMIC_LOADING
+#include <sqlpp11/postgresql/dynamic_libpq.h>
+#endif
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+#ifdef SQLPP_DYNAMIC_LOADING
+    using namespace dynamic;
+#endif
+
+    namespace detail
+    {
+      namespace
+      {
+        bool is_row_result(const PGresult* result)
+        {
+          switch (PQresultStatus(result))
+          {
+            case PGRES_SINGLE_TUPLE:
+#ifdef LIBPQ_HAS_CHUNK_MODE
+            case PGRES_TUPLES_CHUNK:
+#endif
+              return true;
+            default:
+              return false;
+          }
+        }
+      }
+
+      stream_handle_t::stream_handle_t(connection_handle& _connection) : statement_handle_t(_connection)
+      {
+      }
+
+      stream_handle_t::~stream_handle_t()
+      {
+        if (!_finished)
+        {
+          cancel();
+        }
+      }
+
+      void stream_handle_t::start(int chunkRows)
+      {
+#ifdef LIBPQ_HAS_CHUNK_MODE
+        const bool started = (chunkRows > 1) ? PQsetChunkedRowsMode(connection.native(), chunkRows) == 1
+                                             : PQsetSingleRowMode(connection.native()) == 1;
+#else
+        (void)chunkRows;
+        const bool started = PQsetSingleRowMode(connection.native()) == 1;
+#endif
+        valid = true;
+        if (!started)
+        {
+          cancel();
+          throw sqlpp::exception("PostgreSQL error: could not switch to single row mode");
+        }
+      }
+
+      bool stream_handle_t::fetch_next_result()
+      {
+        if (_finished)
+        {
+          return false;
+        }
+
+        clearResult();
+        PGresult* next = PQgetResult(connection.native());
+        if (!next)
+        {
+          _finished = true;
+          return false;
+        }
+
+        if (is_row_result(next))
+        {
+          trace_partial(trace, next);
+          result = next;
+          return true;
+        }
+
+        // The final (empty) result or an error: read up to the end of the query, so the connection can be used again
+        // before reporting it
+        _finished = true;
+        finish_trace(trace, next);
+        drain();
+        result = next;
+        return true;
+      }
+
+      void stream_handle_t::cancel()
+      {
+        PGcancel* cancel = PQgetCancel(connection.native());
+        if (cancel)
+        {
+          char error[256];
+          PQcancel(cancel, error, sizeof(error));
+          PQfreeCancel(cancel);
+        }
+        drain();
+        _finished = true;
+      }
+
+      void stream_handle_t::drain()
+      {
+        while (PGresult* pending = PQgetResult(connection.native()))
+        {
+          if (is_row_result(pending))
+          {
+            trace_partial(trace, pending);
+          }
+          else
+          {
+            // Usually the error of the canceled query
+            finish_trace(trace, pending);
+          }
+          PQclear(pending);
+        }
+        finish_trace(trace, nullptr);
+      }
+    }
+  }
+}
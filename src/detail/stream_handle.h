@@ -0,0 +1,73 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_POSTGRESQL_STREAM_HANDLE_H
+#define SQLPP_POSTGRESQL_STREAM_HANDLE_H
+
+#include <memory>
+
+#include "prepared_statement_handle.h"
+#include "statement_trace.h"
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+    namespace detail
+    {
+      // Handle for a query sent with PQsendQuery / PQsendQueryPrepared whose rows are fetched while they arrive
+      // (single row mode, or chunked rows mode when libpq supports it). Destroying the handle before all rows were
+      // read cancels the query.
+      struct DLL_PUBLIC stream_handle_t : public statement_handle_t
+      {
+        stream_handle_t(detail::connection_handle& _connection);
+        stream_handle_t(const stream_handle_t&) = delete;
+        stream_handle_t(stream_handle_t&&) = delete;
+        stream_handle_t& operator=(const stream_handle_t&) = delete;
+        stream_handle_t& operator=(stream_handle_t&&) = delete;
+
+        virtual ~stream_handle_t();
+
+        // Started before the query was sent, finished with its last result
+        std::unique_ptr<deferred_trace_t> trace;
+
+        // Switches the query just sent to row by row delivery, chunkRows > 1 requires libpq 17 or later
+        void start(int chunkRows);
+
+        bool fetch_next_result() override;
+
+      private:
+        bool _finished{false};
+
+        void cancel();
+        void drain();
+      };
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,234 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SQLPP_POSTGRESQL_TEXT_FORMAT_H
+#define SQLPP_POSTGRESQL_TEXT_FORMAT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <date/date.h>
+#include <sqlpp11/chrono.h>
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+    namespace detail
+    {
+      // Parsers for the text format of dates and timestamps with the default ISO DateStyle:
+      //
+      // 1900-01-01 - date only
+      // 2010-10-11 01:02:03 - timestamp without time zone
+      // 2011-11-12 01:02:03.123456 - with sub-second (microsecond) precision
+      // 1997-12-17 07:37:16-08 - timestamp with time zone
+      // 1992-10-10 01:02:03-06:30 - for some time zones with non-hour offset
+      // 1883-11-18 12:00:00-04:56:02 - local mean time offsets have seconds
+      // 12345-01-01 / 0044-03-15 BC - years after 9999 and before the common era
+      //
+      // The layout after the year is fixed, so the fields are read at known positions and validated together
+      // instead of being scanned for.
+
+      // Value of a digit, anything that is not a digit is above 9
+      inline unsigned digit(char c)
+      {
+        return static_cast<unsigned>(static_cast<unsigned char>(c)) - '0';
+      }
+
+      inline bool two_digits(const char* text, unsigned& value)
+      {
+        const auto high = digit(text[0]);
+        const auto low = digit(text[1]);
+        value = high * 10 + low;
+        return (high <= 9) & (low <= 9);
+      }
+
+      // 1 for 'infinity', -1 for '-infinity', 0 for anything else. Bound like the binary format: as the largest and
+      // smallest value.
+      inline int infinity(const char* text, size_t length)
+      {
+        if (length == 8 && std::memcmp(text, "infinity", 8) == 0)
+        {
+          return 1;
+        }
+        if (length == 9 && std::memcmp(text, "-infinity", 9) == 0)
+        {
+          return -1;
+        }
+        return 0;
+      }
+
+      // Strips a trailing " BC" and returns whether there was one
+      inline bool before_common_era(const char* text, size_t& length)
+      {
+        if (length > 3 && text[length - 3] == ' ' && text[length - 2] == 'B' && text[length - 1] == 'C')
+        {
+          length -= 3;
+          return true;
+        }
+        return false;
+      }
+
+      // Parses the date at the start of the text. Returns its length, or 0 if there is no valid date.
+      inline size_t parse_iso_date(const char* text, size_t length, bool bc, ::sqlpp::chrono::day_point& value)
+      {
+        if (length < 10)
+        {
+          return 0;
+        }
+        unsigned y1, y2;
+        if (!(two_digits(text, y1) & two_digits(text + 2, y2)))
+        {
+          return 0;
+        }
+        int year = static_cast<int>(y1 * 100 + y2);
+        size_t year_digits = 4;
+        while (year_digits < length && digit(text[year_digits]) <= 9 && year_digits < 7)
+        {
+          year = year * 10 + static_cast<int>(digit(text[year_digits]));
+          ++year_digits;
+        }
+
+        const auto month_day = text + year_digits;
+        unsigned month, day;
+        const bool valid = (length >= year_digits + 6) && (month_day[0] == '-') & (month_day[3] == '-') &
+                           two_digits(month_day + 1, month) & two_digits(month_day + 4, day) & (month - 1 < 12) &
+                           (day - 1 < 31);
+        if (!valid)
+        {
+          return 0;
+        }
+
+        // There is no year 0, 1 BC is year 0 of the proleptic Gregorian calendar
+        value =
+            ::sqlpp::chrono::day_point(::date::year(bc ? 1 - year : year) / ::date::month(month) / ::date::day(day));
+        return year_digits + 6;
+      }
+
+      // Anything after the date, e.g. the time of a timestamp, is ignored
+      inline bool parse_iso_date(const char* text, size_t length, ::sqlpp::chrono::day_point& value)
+      {
+        if (const int sign = infinity(text, length))
+        {
+          value = sign > 0 ? ::sqlpp::chrono::day_point::max() : ::sqlpp::chrono::day_point::min();
+          return true;
+        }
+        const bool bc = before_common_era(text, length);
+        return parse_iso_date(text, length, bc, value) != 0;
+      }
+
+      // The offset of a timestamp with time zone is added to the value, as bind_result_t always did
+      inline bool parse_iso_date_time(const char* text, size_t length, ::sqlpp::chrono::microsecond_point& value)
+      {
+        if (const int sign = infinity(text, length))
+        {
+          value = sign > 0 ? ::sqlpp::chrono::microsecond_point::max() : ::sqlpp::chrono::microsecond_point::min();
+          return true;
+        }
+        const bool bc = before_common_era(text, length);
+        ::sqlpp::chrono::day_point day;
+        const auto date_length = parse_iso_date(text, length, bc, day);
+        if (!date_length)
+        {
+          return false;
+        }
+        value = day;
+        if (date_length == length)
+        {
+          return true;
+        }
+
+        // ' 13:12:11' (or standard: 'T13:12:11')
+        const auto time = text + date_length;
+        length -= date_length;
+        unsigned hours, minutes, seconds;
+        const bool valid = (length >= 9) && ((time[0] == ' ') | (time[0] == 'T')) & (time[3] == ':') &
+                           (time[6] == ':') & two_digits(time + 1, hours) & two_digits(time + 4, minutes) &
+                           two_digits(time + 7, seconds) & (hours <= 24) & (minutes < 60) & (seconds <= 60);
+        if (!valid)
+        {
+          return false;
+        }
+        int64_t microseconds = ((hours * 60 + minutes) * 60 + seconds) * INT64_C(1000000);
+
+        size_t position = 9;
+        if (position < length && time[position] == '.')
+        {
+          // Trailing zeros are omitted, so there are one to six digits
+          static const int64_t scale[] = {0, 100000, 10000, 1000, 100, 10, 1};
+          size_t digits = 0;
+          unsigned fraction = 0;
+          ++position;
+          while (position + digits < length && digits < 6 && digit(time[position + digits]) <= 9)
+          {
+            fraction = fraction * 10 + digit(time[position + digits]);
+            ++digits;
+          }
+          if (!digits)
+          {
+            return false;
+          }
+          microseconds += fraction * scale[digits];
+          position += digits;
+        }
+
+        if (position < length)
+        {
+          // -05, +05:30 or -04:56:02
+          const auto zone = time + position;
+          const auto zone_length = length - position;
+          unsigned zone_hours, zone_minutes = 0, zone_seconds = 0;
+          if (zone_length != 3 && zone_length != 6 && zone_length != 9)
+          {
+            return false;
+          }
+          bool valid_zone = ((zone[0] == '+') | (zone[0] == '-')) & two_digits(zone + 1, zone_hours);
+          if (zone_length >= 6)
+          {
+            valid_zone &= (zone[3] == ':') & two_digits(zone + 4, zone_minutes);
+          }
+          if (zone_length == 9)
+          {
+            valid_zone &= (zone[6] == ':') & two_digits(zone + 7, zone_seconds);
+          }
+          if (!valid_zone)
+          {
+            return false;
+          }
+          const int64_t offset = ((zone_hours * 60 + zone_minutes) * 60 + zone_seconds) * INT64_C(1000000);
+          microseconds += zone[0] == '-' ? -offset : offset;
+        }
+
+        value += std::chrono::microseconds(microseconds);
+        return true;
+      }
+    }  // namespace detail
+  }  // namespace postgresql
+}  // namespace sqlpp
+
+#endif
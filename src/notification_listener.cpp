@@ -0,0 +1,226 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp11/exception.h>
+#include <sqlpp11/postgresql/connection.h>
+#include <sqlpp11/postgresql/notification_listener.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#else
+#include <poll.h>
+#endif
+
+#ifdef SQLPP_DYNAMIC_LOADING
+#include <sqlpp11/postgresql/dynamic_libpq.h>
+#endif
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+#ifdef SQLPP_DYNAMIC_LOADING
+    using namespace dynamic;
+#endif
+
+    namespace
+    {
+      std::string quote_identifier(PGconn* connection, const std::string& name)
+      {
+        char* quoted = PQescapeIdentifier(connection, name.c_str(), name.size());
+        if (!quoted)
+        {
+          throw sqlpp::exception("PostgreSQL error: invalid channel name: " + std::string(PQerrorMessage(connection)));
+        }
+        std::string result(quoted);
+        PQfreemem(quoted);
+        return result;
+      }
+
+      // Moves the notifications libpq has read so far into the batch
+      void drain(PGconn* connection, std::vector<notification_t>& batch)
+      {
+        while (PGnotify* notification = PQnotifies(connection))
+        {
+          batch.push_back(
+              {notification->relname, notification->extra ? notification->extra : "", notification->be_pid});
+          PQfreemem(notification);
+        }
+      }
+
+      // Returns false after the timeout, -1 waits without a timeout
+      bool wait_readable(int socket, int timeout_ms)
+      {
+#ifdef _WIN32
+        WSAPOLLFD descriptor{};
+        descriptor.fd = static_cast<SOCKET>(socket);
+        descriptor.events = POLLRDNORM;
+        const int ready = WSAPoll(&descriptor, 1, timeout_ms);
+        if (ready < 0)
+        {
+          throw sqlpp::exception("PostgreSQL error: waiting for notifications failed");
+        }
+#else
+        pollfd descriptor{};
+        descriptor.fd = socket;
+        descriptor.events = POLLIN;
+        const int ready = ::poll(&descriptor, 1, timeout_ms);
+        if (ready < 0)
+        {
+          if (errno == EINTR)
+          {
+            return true;
+          }
+          throw sqlpp::exception("PostgreSQL error: waiting for notifications failed");
+        }
+#endif
+        return ready > 0;
+      }
+    }  // namespace
+
+    notification_listener_t::notification_listener_t(connection& db, const std::vector<std::string>& channels)
+        : _db(db)
+    {
+      for (const auto& channel : channels)
+      {
+        listen(channel);
+      }
+    }
+
+    notification_listener_t::~notification_listener_t()
+    {
+      try
+      {
+        while (!_channels.empty())
+        {
+          const auto channel = std::move(_channels.back());
+          _channels.pop_back();
+          _db.execute("UNLISTEN " + quote_identifier(_db.native_handle(), channel));
+        }
+      }
+      catch (const std::exception&)
+      {
+        // The connection is gone or in an aborted transaction, it does not listen anymore once it is closed
+      }
+    }
+
+    void notification_listener_t::listen(const std::string& channel)
+    {
+      if (std::find(_channels.begin(), _channels.end(), channel) != _channels.end())
+      {
+        return;
+      }
+      _db.execute("LISTEN " + quote_identifier(_db.native_handle(), channel));
+      _channels.push_back(channel);
+    }
+
+    void notification_listener_t::unlisten(const std::string& channel)
+    {
+      const auto found = std::find(_channels.begin(), _channels.end(), channel);
+      if (found == _channels.end())
+      {
+        return;
+      }
+      // Forgotten only once the session stopped listening, so that a failed UNLISTEN can be retried
+      _db.execute("UNLISTEN " + quote_identifier(_db.native_handle(), channel));
+      _channels.erase(found);
+    }
+
+    int notification_listener_t::socket() const
+    {
+      return PQsocket(_db.native_handle());
+    }
+
+    std::vector<notification_t> notification_listener_t::poll()
+    {
+      PGconn* connection = _db.native_handle();
+      std::vector<notification_t> batch;
+      if (!PQconsumeInput(connection))
+      {
+        throw sqlpp::exception("PostgreSQL error: could not read notifications: " +
+                               std::string(PQerrorMessage(connection)));
+      }
+      drain(connection, batch);
+      return batch;
+    }
+
+    std::vector<notification_t> notification_listener_t::wait()
+    {
+      return wait_for(-1);
+    }
+
+    std::vector<notification_t> notification_listener_t::wait(std::chrono::milliseconds timeout)
+    {
+      return wait_for(static_cast<int>(std::max<std::chrono::milliseconds::rep>(
+          0, std::min<std::chrono::milliseconds::rep>(timeout.count(), INT_MAX))));
+    }
+
+    std::vector<notification_t> notification_listener_t::wait_for(int timeout_ms)
+    {
+      // Received while running other statements
+      std::vector<notification_t> batch;
+      drain(_db.native_handle(), batch);
+      if (!batch.empty())
+      {
+        return batch;
+      }
+
+      const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+      for (;;)
+      {
+        int remaining = -1;
+        if (timeout_ms >= 0)
+        {
+          const auto left =
+              std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+          remaining = static_cast<int>(std::max<std::chrono::milliseconds::rep>(0, left.count()));
+        }
+        // -1 when the connection is broken, poll() would ignore it and wait forever
+        const int descriptor = socket();
+        if (descriptor < 0)
+        {
+          throw sqlpp::exception("PostgreSQL error: cannot wait for notifications without a connection: " +
+                                 std::string(PQerrorMessage(_db.native_handle())));
+        }
+        if (!wait_readable(descriptor, remaining))
+        {
+          return batch;
+        }
+        // Data on the socket is not necessarily a notification, e.g. parameter status messages
+        batch = poll();
+        if (!batch.empty())
+        {
+          return batch;
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,283 @@
+/**
+ * Copyright © 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this
+ *   list of conditions and the following disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice,
+ *   this list of conditions and the following disclaimer in the documentation
+ *   and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp11/exception.h>
+#include <sqlpp11/postgresql/pipeline.h>
+
+#include <iostream>
+
+#include "detail/connection_handle.h"
+#include "detail/pipeline_handle.h"
+
+#ifdef SQLPP_DYNAMIC_LOADING
+#include <sqlpp11/postgresql/dynamic_libpq.h>
+#endif
+
+namespace sqlpp
+{
+  namespace postgresql
+  {
+#ifdef SQLPP_DYNAMIC_LOADING
+    using namespace dynamic;
+#endif
+
+    namespace detail
+    {
+      pipeline_state_t::pipeline_state_t(connection_handle& _connection) : connection(_connection)
+      {
+      }
+
+      void pipeline_state_t::enter()
+      {
+#ifdef LIBPQ_HAS_PIPELINING
+        if (PQenterPipelineMode(connection.native()) != 1)
+        {
+          throw sqlpp::exception("PostgreSQL error: could not enter pipeline mode: " +
+                                 std::string(PQerrorMessage(connection.native())));
+        }
+        active = true;
+#else
+        throw sqlpp::exception("PostgreSQL error: pipeline mode requires libpq 14 or later");
+#endif
+      }
+
+      std::shared_ptr<pipeline_handle_t> pipeline_state_t::send(const std::string& stmt)
+      {
+        if (connection.config->debug)
+        {
+          std::cerr << "PostgreSQL debug: sending: " << stmt << std::endl;
+        }
+        auto trace = start_trace(connection, stmt);
+        // PQsendQuery is not allowed in pipeline mode
+        const bool success =
+            PQsendQueryParams(connection.native(), stmt.c_str(), 0, nullptr, nullptr, nullptr, nullptr, 0) == 1;
+        return sent(success, std::move(trace));
+      }
+
+      std::shared_ptr<pipeline_handle_t> pipeline_state_t::send(prepared_statement_handle_t& prepared)
+      {
+        if (connection.config->debug)
+        {
+          std::cerr << "PostgreSQL debug: sending: " << prepared.name() << std::endl;
+        }
+        auto trace = start_trace(connection, prepared.statement(), prepared.metrics());
+        const bool success = prepared.send();
+        return sent(success, std::move(trace));
+      }
+
+      std::shared_ptr<pipeline_handle_t> pipeline_state_t::sent(bool success, std::unique_ptr<deferred_trace_t> trace)
+      {
+        if (!success)
+        {
+          finish_trace(trace, nullptr);
+          throw sqlpp::exception("PostgreSQL error: could not send statement: " +
+                                 std::string(PQerrorMessage(connection.native())));
+        }
+        auto handle = std::make_shared<pipeline_handle_t>(connection);
+        handle->trace = std::move(trace);
+        pending.push_back(handle);
+        synced = false;
+        return handle;
+      }
+
+      void pipeline_state_t::sync()
+      {
+#ifdef LIBPQ_HAS_PIPELINING
+        if (PQpipelineSync(connection.native()) != 1)
+        {
+          throw sqlpp::exception("PostgreSQL error: could not sync pipeline: " +
+                                 std::string(PQerrorMessage(connection.native())));
+        }
+        ++syncs;
+        synced = true;
+#endif
+      }
+
+      void pipeline_state_t::wait_for(const pipeline_handle_t& handle)
+      {
+        while (!handle.ready)
+        {
+          if (!synced)
+          {
+            sync();
+          }
+          read_next();
+        }
+      }
+
+      void pipeline_state_t::read_next()
+      {
+        if (pending.empty())
+        {
+          throw sqlpp::exception("PostgreSQL error: no pipeline results outstanding");
+        }
+
+        PGresult* next = PQgetResult(connection.native());
+#ifdef LIBPQ_HAS_PIPELINING
+        while (next && PQresultStatus(next) == PGRES_PIPELINE_SYNC)
+        {
+          PQclear(next);
+          --syncs;
+          next = PQgetResult(connection.native());
+        }
+#endif
+        if (!next)
+        {
+          throw sqlpp::exception("PostgreSQL error: pipeline result missing: " +
+                                 std::string(PQerrorMessage(connection.native())));
+        }
+
+        auto handle = pending.front();
+        pending.pop_front();
+        handle->ready = true;
+        handle->valid = true;
+        finish_trace(handle->trace, next);
+        try
+        {
+          handle->result = next;
+        }
+        catch (...)
+        {
+          handle->error = std::current_exception();
+        }
+
+        // The results of a statement end with a null result
+        while (PGresult* pendingResult = PQgetResult(connection.native()))
+        {
+          PQclear(pendingResult);
+        }
+      }
+
+      void pipeline_state_t::finish()
+      {
+        if (!active)
+        {
+          return;
+        }
+        if (!synced)
+        {
+          sync();
+        }
+        while (!pending.empty())
+        {
+          read_next();
+        }
+        while (syncs > 0)
+        {
+          PGresult* next = PQgetResult(connection.native());
+          if (!next)
+          {
+            break;
+          }
+#ifdef LIBPQ_HAS_PIPELINING
+          if (PQresultStatus(next) == PGRES_PIPELINE_SYNC)
+          {
+            --syncs;
+          }
+#endif
+          PQclear(next);
+        }
+        active = false;
+#ifdef LIBPQ_HAS_PIPELINING
+        PQexitPipelineMode(connection.native());
+#endif
+      }
+    }
+
+    pipeline_entry_t::pipeline_entry_t(const std::shared_ptr<detail::pipeline_state_t>& state,
+                                       const std::shared_ptr<detail::pipeline_handle_t>& handle)
+        : _state(state), _handle(handle)
+    {
+    }
+
+    void pipeline_entry_t::_wait()
+    {
+      if (!_handle->ready)
+      {
+        _state->wait_for(*_handle);
+      }
+      if (_handle->error)
+      {
+        std::rethrow_exception(_handle->error);
+      }
+    }
+
+    bind_result_t pipeline_entry_t::_bind_result()
+    {
+      _wait();
+      return {_handle};
+    }
+
+    size_t pipeline_entry_t::affected_rows()
+    {
+      _wait();
+      return static_cast<size_t>(_handle->result.affected_rows());
+    }
+
+    pipeline_t::pipeline_t(connection& db) : _db(db)
+    {
+      _db.validate_connection_handle();
+      _state = std::make_shared<detail::pipeline_state_t>(*_db._handle);
+      _state->enter();
+    }
+
+    pipeline_t::~pipeline_t()
+    {
+      if (_state)
+      {
+        try
+        {
+          _state->finish();
+        }
+        catch (const std::exception& e)
+        {
+          std::cerr << "PostgreSQL error: could not finish pipeline: " << e.what() << std::endl;
+        }
+      }
+    }
+
+    pipeline_entry_t pipeline_t::send_impl(const std::string& stmt)
+    {
+      return {_state, _state->send(stmt)};
+    }
+
+    pipeline_entry_t pipeline_t::send_prepared_impl(prepared_statement_t& prep)
+    {
+      return {_state, _state->send(*prep._handle)};
+    }
+
+    void pipeline_t::sync()
+    {
+      _state->sync();
+    }
+
+    void pipeline_t::finish()
+    {
+      _state->finish();
+    }
+  }
+}
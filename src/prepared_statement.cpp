@@ -26,15 +26,20 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <sqlpp11/postgresql/connection_config.h>
 #include <sqlpp11/postgresql/prepared_statement.h>
 #include <sqlpp11/exception.h>
 
+#include "detail/binary_format.h"
 #include "detail/prepared_statement_handle.h"
 
+#include <algorithm>
+#include <atomic>
 #include <ciso646>
+#include <cstdio>
+#include <ctime>
 #include <iostream>
 #include <limits>
-#include <sstream>
 #include <date/date.h>
 
 namespace sqlpp
@@ -46,6 +51,72 @@ namespace sqlpp
     using namespace dynamic;
 #endif
 
+    namespace
+    {
+      // Formats a text parameter in place, the buffers of the parameters keep their capacity between executions
+      template <typename... Args>
+      void format_parameter(std::string& target, const char* format, Args... args)
+      {
+        char buffer[64];
+        const int length = std::snprintf(buffer, sizeof(buffer), format, args...);
+        if (length < static_cast<int>(sizeof(buffer)))
+        {
+          target.assign(buffer, static_cast<size_t>(length));
+          return;
+        }
+        target.resize(static_cast<size_t>(length) + 1);
+        std::snprintf(&target[0], target.size(), format, args...);
+        target.resize(static_cast<size_t>(length));
+      }
+
+      // The binary array format: the number of dimensions, a flag for null elements, the element type and the size
+      // and lower bound of each dimension, followed by the elements, each prefixed by its length. An empty array has
+      // no dimensions.
+      char* write_array_header(char* data, Oid element_type, size_t size)
+      {
+        detail::write_int32(data, size ? 1 : 0);
+        detail::write_int32(data + 4, 0);
+        detail::write_uint32(data + 8, element_type);
+        if (!size)
+        {
+          return data + 12;
+        }
+        detail::write_int32(data + 12, static_cast<int32_t>(size));
+        detail::write_int32(data + 16, 1);
+        return data + 20;
+      }
+
+      size_t array_header_length(size_t size)
+      {
+        return size ? 20 : 12;
+      }
+
+      // Appends an element of an array literal, e.g. {1,2} or {"it's","a \"quote\""}, quoted unless it is a
+      // number or a uuid
+      void append_array_element(std::string& target, const std::string& element, bool quote)
+      {
+        if (target.size() > 1)
+        {
+          target += ',';
+        }
+        if (!quote)
+        {
+          target += element;
+          return;
+        }
+        target += '"';
+        for (const auto c : element)
+        {
+          if (c == '"' || c == '\\')
+          {
+            target += '\\';
+          }
+          target += c;
+        }
+        target += '"';
+      }
+    }
+
     // ctor
     prepared_statement_t::prepared_statement_t(std::shared_ptr<detail::prepared_statement_handle_t>&& handle)
         : _handle{handle}
@@ -66,7 +137,11 @@ namespace sqlpp
       }
 
       _handle->nullValues[index] = is_null;
-      if (!is_null)
+      if (!is_null && _handle->is_binary_parameter(index))
+      {
+        *_handle->binary_parameter(index, 1) = *value ? 1 : 0;
+      }
+      else if (!is_null)
       {
         if (*value)
         {
@@ -88,12 +163,13 @@ namespace sqlpp
       }
 
       _handle->nullValues[index] = is_null;
-      if (!is_null)
+      if (!is_null && _handle->is_binary_parameter(index))
+      {
+        detail::write_float8(_handle->binary_parameter(index, 8), *value);
+      }
+      else if (!is_null)
       {
-        std::ostringstream out;
-        out.precision(std::numeric_limits<double>::digits10);
-        out << std::fixed << *value;
-        _handle->paramValues[index] = out.str();
+        format_parameter(_handle->paramValues[index], "%.*f", std::numeric_limits<double>::digits10, *value);
       }
     }
 
@@ -107,9 +183,13 @@ namespace sqlpp
 
       // Assign values
       _handle->nullValues[index] = is_null;
-      if (!is_null)
+      if (!is_null && _handle->is_binary_parameter(index))
+      {
+        detail::write_int64(_handle->binary_parameter(index, 8), *value);
+      }
+      else if (!is_null)
       {
-        _handle->paramValues[index] = std::to_string(*value);
+        format_parameter(_handle->paramValues[index], "%lld", static_cast<long long>(*value));
       }
     }
 
@@ -137,12 +217,16 @@ namespace sqlpp
                   << index << ", being " << (is_null ? "" : "not ") << "null" <<  std::endl;
       }
       _handle->nullValues[index] = is_null;
-      if (not is_null)
+      if (not is_null && _handle->is_binary_parameter(index))
+      {
+        const auto days = value->time_since_epoch().count() - detail::pg_epoch_days;
+        detail::write_int32(_handle->binary_parameter(index, 4), static_cast<int32_t>(days));
+      }
+      else if (not is_null)
       {
         const auto ymd = ::date::year_month_day{*value};
-        std::ostringstream os;
-        os << ymd;
-        _handle->paramValues[index] = os.str();
+        format_parameter(_handle->paramValues[index], "%04d-%02u-%02u", static_cast<int>(ymd.year()),
+                         static_cast<unsigned>(ymd.month()), static_cast<unsigned>(ymd.day()));
 
         if (_handle->debug())
         {
@@ -153,53 +237,96 @@ namespace sqlpp
 
     namespace {
 
-      long get_timezone_offset()
+      // Offset of the local time zone from UTC at the given time, in seconds
+      long local_offset(time_t time)
       {
-         static time_t last_query = 0;
-         static long offset = 0;
-         time_t now = time(nullptr);
-         // only update once an hour
-         if (now - last_query > 3600)
-         {
-#if defined(_WINDOWS) || defined(__MINGW32__)
-            offset = -_timezone;
+        struct tm local;
+#if defined(_WIN32)
+        localtime_s(&local, &time);
 #else
-            struct tm* tm  = std::localtime(&now);
-            offset = tm->tm_gmtoff;
-            last_query = now;
+        localtime_r(&time, &local);
 #endif
-         }
-         return offset;
+        const auto days = ::date::sys_days(::date::year(local.tm_year + 1900) / (local.tm_mon + 1) / local.tm_mday);
+        const auto local_seconds = static_cast<int64_t>(days.time_since_epoch().count()) * 86400 +
+                                   local.tm_hour * 3600 + local.tm_min * 60 + local.tm_sec;
+        return static_cast<long>(local_seconds - time);
       }
-    }
 
-    void prepared_statement_t::_bind_date_time_parameter(size_t index, const ::sqlpp::chrono::microsecond_point* value, bool is_null)
-    {
-      if (_handle->debug())
+      // The current offset together with the time until which it is valid, packed into one word so that any thread
+      // can read and refresh it without a lock. The offset (less than a day either way) takes the lower 20 bits.
+      std::atomic<uint64_t> timezone_cache{0};
+      constexpr int offset_bits = 20;
+      constexpr int64_t offset_bias = int64_t{1} << (offset_bits - 1);
+
+      long get_timezone_offset()
       {
-        std::cerr << "PostgreSQL debug: binding date_time parameter at index "
-          << index << ", being " << (is_null ? "" : "not ") << "null" << std::endl;
+        const time_t now = time(nullptr);
+        const auto cached = timezone_cache.load(std::memory_order_relaxed);
+        if (static_cast<time_t>(cached >> offset_bits) > now)
+        {
+          return static_cast<long>(static_cast<int64_t>(cached & ((uint64_t{1} << offset_bits) - 1)) - offset_bias);
+        }
+
+        // Valid for an hour, or up to the next daylight saving time transition within that hour
+        const long offset = local_offset(now);
+        time_t valid_until = now + 3600;
+        if (local_offset(valid_until) != offset)
+        {
+          time_t same = now;
+          while (valid_until - same > 1)
+          {
+            const time_t middle = same + (valid_until - same) / 2;
+            (local_offset(middle) == offset ? same : valid_until) = middle;
+          }
+        }
+        timezone_cache.store((static_cast<uint64_t>(valid_until) << offset_bits) |
+                                 static_cast<uint64_t>(offset + offset_bias),
+                             std::memory_order_relaxed);
+        return offset;
       }
-      _handle->nullValues[index] = is_null;
-      if (not is_null)
+
+      void format_timestamp(std::string& target, const ::sqlpp::chrono::microsecond_point& value, bool utc)
       {
-        const auto dp = ::sqlpp::chrono::floor<::date::days>(*value);
-        const auto time = ::date::make_time(::sqlpp::chrono::floor<::std::chrono::microseconds>(*value - dp));
+        const auto dp = ::sqlpp::chrono::floor<::date::days>(value);
+        const auto time = ::date::make_time(::sqlpp::chrono::floor<::std::chrono::microseconds>(value - dp));
         const auto ymd = ::date::year_month_day{dp};
 
-        // Timezone handling - always treat the value as local time and always add the local time zone. The
-        // "without time zone" type will just ignore it, while the "with time zone" type will store it and use
-        // it to produce a correct answer in the correct time zone
-        long tz_off = get_timezone_offset();
+        // Timezone handling - unless configured for UTC, always treat the value as local time and always add the
+        // local time zone. The "without time zone" type will just ignore it, while the "with time zone" type will
+        // store it and use it to produce a correct answer in the correct time zone
+        long tz_off = utc ? 0 : get_timezone_offset();
         const char tz_sign = tz_off > 0 ? '+' : '-';
         if (tz_off < 0) tz_off = -tz_off;
 
         const long tz_hour = tz_off/3600;
         const long tz_min = (tz_off % 3600) / 60;
 
-        std::ostringstream os;
-        os << ymd << ' ' << time << tz_sign << tz_hour << ":" << tz_min;
-        _handle->paramValues[index] = os.str();
+        format_parameter(target, "%04d-%02u-%02u %02d:%02d:%02d.%06lld%c%02ld:%02ld", static_cast<int>(ymd.year()),
+                         static_cast<unsigned>(ymd.month()), static_cast<unsigned>(ymd.day()),
+                         static_cast<int>(time.hours().count()), static_cast<int>(time.minutes().count()),
+                         static_cast<int>(time.seconds().count()), static_cast<long long>(time.subseconds().count()),
+                         tz_sign, tz_hour, tz_min);
+      }
+    }
+
+    void prepared_statement_t::_bind_date_time_parameter(size_t index, const ::sqlpp::chrono::microsecond_point* value, bool is_null)
+    {
+      if (_handle->debug())
+      {
+        std::cerr << "PostgreSQL debug: binding date_time parameter at index "
+          << index << ", being " << (is_null ? "" : "not ") << "null" << std::endl;
+      }
+      _handle->nullValues[index] = is_null;
+      if (not is_null && _handle->is_binary_parameter(index))
+      {
+        // Binary timestamps are sent as UTC, no time zone handling needed
+        const auto microseconds =
+            std::chrono::duration_cast<std::chrono::microseconds>(value->time_since_epoch()).count();
+        detail::write_int64(_handle->binary_parameter(index, 8), microseconds - detail::pg_epoch_microseconds);
+      }
+      else if (not is_null)
+      {
+        format_timestamp(_handle->paramValues[index], *value, _handle->connection.config->utc_timestamps);
         if (_handle->debug())
         {
           std::cerr << "PostgreSQL debug: binding date_time parameter string: " << _handle->paramValues[index] << std::endl;
@@ -207,5 +334,154 @@ namespace sqlpp
       }
     }
 
+    void prepared_statement_t::_bind_array_parameter(size_t index, const std::vector<int64_t>* value, bool is_null)
+    {
+      if (_handle->debug())
+      {
+        std::cerr << "PostgreSQL debug: binding integral array parameter of " << value->size()
+                  << " elements at index: " << index << ", being " << (is_null ? "" : "not ") << "null" << std::endl;
+      }
+
+      _handle->nullValues[index] = is_null;
+      if (!is_null && _handle->is_binary_parameter(index))
+      {
+        const auto length = array_header_length(value->size()) + value->size() * 12;
+        auto data = write_array_header(_handle->binary_parameter(index, static_cast<int>(length)), type_oid::int8,
+                                       value->size());
+        for (const auto element : *value)
+        {
+          detail::write_int32(data, 8);
+          detail::write_int64(data + 4, element);
+          data += 12;
+        }
+      }
+      else if (!is_null)
+      {
+        auto& target = _handle->paramValues[index];
+        target.assign(1, '{');
+        std::string element;
+        for (const auto e : *value)
+        {
+          format_parameter(element, "%lld", static_cast<long long>(e));
+          append_array_element(target, element, false);
+        }
+        target += '}';
+      }
+    }
+
+    void prepared_statement_t::_bind_array_parameter(size_t index, const std::vector<std::string>* value, bool is_null)
+    {
+      if (_handle->debug())
+      {
+        std::cerr << "PostgreSQL debug: binding text array parameter of " << value->size()
+                  << " elements at index: " << index << ", being " << (is_null ? "" : "not ") << "null" << std::endl;
+      }
+
+      _handle->nullValues[index] = is_null;
+      if (!is_null && _handle->is_binary_parameter(index))
+      {
+        auto length = array_header_length(value->size());
+        for (const auto& element : *value)
+        {
+          length += 4 + element.size();
+        }
+        auto data = write_array_header(_handle->binary_parameter(index, static_cast<int>(length)), type_oid::text,
+                                       value->size());
+        for (const auto& element : *value)
+        {
+          detail::write_int32(data, static_cast<int32_t>(element.size()));
+          std::copy(element.begin(), element.end(), data + 4);
+          data += 4 + element.size();
+        }
+      }
+      else if (!is_null)
+      {
+        auto& target = _handle->paramValues[index];
+        target.assign(1, '{');
+        for (const auto& element : *value)
+        {
+          append_array_element(target, element, true);
+        }
+        target += '}';
+      }
+    }
+
+    void prepared_statement_t::_bind_array_parameter(size_t index,
+                                                     const std::vector<::sqlpp::chrono::microsecond_point>* value,
+                                                     bool is_null)
+    {
+      if (_handle->debug())
+      {
+        std::cerr << "PostgreSQL debug: binding date_time array parameter of " << value->size()
+                  << " elements at index: " << index << ", being " << (is_null ? "" : "not ") << "null" << std::endl;
+      }
+
+      _handle->nullValues[index] = is_null;
+      if (!is_null && _handle->is_binary_parameter(index))
+      {
+        const auto length = array_header_length(value->size()) + value->size() * 12;
+        auto data = write_array_header(_handle->binary_parameter(index, static_cast<int>(length)),
+                                       type_oid::timestamptz, value->size());
+        for (const auto& element : *value)
+        {
+          const auto microseconds =
+              std::chrono::duration_cast<std::chrono::microseconds>(element.time_since_epoch()).count();
+          detail::write_int32(data, 8);
+          detail::write_int64(data + 4, microseconds - detail::pg_epoch_microseconds);
+          data += 12;
+        }
+      }
+      else if (!is_null)
+      {
+        auto& target = _handle->paramValues[index];
+        target.assign(1, '{');
+        const bool utc = _handle->connection.config->utc_timestamps;
+        std::string element;
+        for (const auto& e : *value)
+        {
+          format_timestamp(element, e, utc);
+          append_array_element(target, element, true);
+        }
+        target += '}';
+      }
+    }
+
+    void prepared_statement_t::_bind_uuid_array_parameter(size_t index, const std::string* value, bool is_null)
+    {
+      const auto size = value->size() / 16;
+      if (_handle->debug())
+      {
+        std::cerr << "PostgreSQL debug: binding uuid array parameter of " << size << " elements at index: " << index
+                  << ", being " << (is_null ? "" : "not ") << "null" << std::endl;
+      }
+
+      _handle->nullValues[index] = is_null;
+      if (!is_null && _handle->is_binary_parameter(index))
+      {
+        const auto length = array_header_length(size) + size * 20;
+        auto data =
+            write_array_header(_handle->binary_parameter(index, static_cast<int>(length)), type_oid::uuid, size);
+        for (size_t i = 0; i < size; ++i)
+        {
+          detail::write_int32(data, 16);
+          std::copy(value->data() + i * 16, value->data() + (i + 1) * 16, data + 4);
+          data += 20;
+        }
+      }
+      else if (!is_null)
+      {
+        auto& target = _handle->paramValues[index];
+        target.assign(1, '{');
+        std::string element;
+        for (size_t i = 0; i < size; ++i)
+        {
+          element.clear();
+          detail::append_uuid(element, value->data() + i * 16);
+          append_array_element(target, element, false);
+        }
+        target += '}';
+      }
+    }
+
   }
 }
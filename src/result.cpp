@@ -72,6 +72,11 @@ namespace sqlpp
       return const_cast<const char*>(PQgetvalue(result, record, field));
     }
 
+    int Result::getPqLength(PGresult* result, int record, int field) const
+    {
+      return PQgetlength(result, record, field);
+    }
+
     [[noreturn]] void Result::ThrowSQLError(const std::string& Err, const std::string& Query) const
     {
       // Try to establish more precise error type, and throw corresponding exception
@@ -172,6 +177,10 @@ namespace sqlpp
         case PGRES_EMPTY_QUERY:  // The string sent to the backend was empty.
         case PGRES_COMMAND_OK:   // Successful completion of a command returning no data
         case PGRES_TUPLES_OK:    // The query successfully executed
+        case PGRES_SINGLE_TUPLE:  // A single row of a query in single row mode
+#ifdef LIBPQ_HAS_CHUNK_MODE
+        case PGRES_TUPLES_CHUNK:  // Some rows of a query in chunked rows mode
+#endif
           break;
 
         case PGRES_COPY_OUT:  // Copy Out (from server) data transfer started
@@ -183,8 +192,14 @@ namespace sqlpp
         case PGRES_FATAL_ERROR:
           Err = PQresultErrorMessage(m_result);
           break;
+#ifdef LIBPQ_HAS_PIPELINING
+        case PGRES_PIPELINE_SYNC:  // End of a pipeline sync point
+          break;
+        case PGRES_PIPELINE_ABORTED:  // Not executed because of an earlier error in the pipeline
+          Err = "PostgreSQL error: statement skipped after an earlier error in the pipeline";
+          break;
+#endif
         case PGRES_COPY_BOTH:
-        case PGRES_SINGLE_TUPLE:
           throw sqlpp::exception("pqxx::result: Unrecognized response code " +
                                  std::to_string(PQresultStatus(m_result)));
       }
@@ -243,6 +258,21 @@ namespace sqlpp
       return PQgetlength(m_result, record, field);
     }
 
+    Oid Result::field_type(int field) const
+    {
+      return PQftype(m_result, field);
+    }
+
+    const char* Result::field_name(int field) const
+    {
+      return PQfname(m_result, field);
+    }
+
+    bool Result::is_binary(int field) const
+    {
+      return PQfformat(m_result, field) == 1;
+    }
+
     Result::~Result()
     {
       clear();
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "TabFoo.h"
+#include <sqlpp11/data_types/uuid.h>
+#include <sqlpp11/postgresql/postgresql.h>
+#include <sqlpp11/sqlpp11.h>
+
+#include <boost/uuid/string_generator.hpp>
+
+#include <iostream>
+
+namespace
+{
+  template <typename L, typename R>
+  void require_equal(int line, const L& l, const R& r)
+  {
+    if (l != r)
+    {
+      std::cerr << line << ": ";
+      serialize(::sqlpp::wrap_operand_t<L>{l}, std::cerr);
+      std::cerr << " != ";
+      serialize(::sqlpp::wrap_operand_t<R>{r}, std::cerr);
+      throw std::runtime_error("Unexpected result");
+    }
+  }
+}
+
+namespace sql = sqlpp::postgresql;
+int ArrayParameter(int, char*[])
+{
+  auto config = std::make_shared<sql::connection_config>();
+
+#ifdef WIN32
+  config->dbname = "test";
+  config->user = "test";
+  config->password = "test";
+  config->debug = true;
+#else
+  // TODO: assume there is a DB with the "username" as a name and the current user has "peer" access rights
+  config->dbname = getenv("USER");
+  config->user = config->dbname;
+  config->debug = false;
+#endif
+
+  try
+  {
+    for (const auto binary_parameters : {false, true})
+    {
+      config->binary_parameters = binary_parameters;
+      sql::connection db(config);
+      db.execute(R"(DROP TABLE IF EXISTS tabfoo;)");
+      db.execute(R"(CREATE TABLE tabfoo
+                   (
+                     alpha bigserial NOT NULL,
+                     beta smallint,
+                     gamma text,
+                     c_bool boolean,
+                     c_timepoint timestamp with time zone,
+                     c_day date,
+                     c_uuid uuid
+                   ))");
+      db.execute(R"(INSERT INTO tabfoo (beta, gamma, c_timepoint, c_uuid)
+                    SELECT i % 10, 'row ' || i, '2020-01-01 00:00:00+00'::timestamptz + i * interval '1 hour',
+                           ('00000000-0000-0000-0000-' || lpad(i::text, 12, '0'))::uuid
+                    FROM generate_series(1, 100) i)");
+      db.execute(R"(UPDATE tabfoo SET gamma = 'it''s "quoted" \' WHERE alpha = 100)");
+
+      model::TabFoo tab = {};
+
+      // The statement text is the same for any number of values
+      auto by_alpha = db.prepare(
+          select(count(tab.alpha)).from(tab).where(sqlpp::postgresql::in_array(tab.alpha)));
+      by_alpha.params.alpha = std::vector<int64_t>{1, 2, 3, 500};
+      require_equal(__LINE__, db(by_alpha).front().count.value(), 3);
+      by_alpha.params.alpha = std::vector<int64_t>{};
+      require_equal(__LINE__, db(by_alpha).front().count.value(), 0);
+      std::vector<int64_t> many;
+      for (int64_t i = 1; i <= 50; ++i)
+      {
+        many.push_back(i * 2);
+      }
+      by_alpha.params.alpha = many;
+      require_equal(__LINE__, db(by_alpha).front().count.value(), 50);
+
+      auto by_gamma = db.prepare(
+          select(tab.alpha).from(tab).where(sqlpp::postgresql::in_array(tab.gamma)).order_by(tab.alpha.asc()));
+      by_gamma.params.gamma = std::vector<std::string>{"row 7", "it's \"quoted\" \\", "row 99"};
+      std::vector<int64_t> alphas;
+      for (const auto& row : db(by_gamma))
+      {
+        alphas.push_back(row.alpha.value());
+      }
+      require_equal(__LINE__, static_cast<int>(alphas.size()), 3);
+      require_equal(__LINE__, alphas[0], 7);
+      require_equal(__LINE__, alphas[2], 100);
+
+      auto by_time = db.prepare(
+          select(count(tab.alpha)).from(tab).where(sqlpp::postgresql::in_array(tab.c_timepoint)));
+      const auto start = db(select(tab.c_timepoint).from(tab).where(tab.alpha == 1)).front().c_timepoint.value();
+      by_time.params.c_timepoint =
+          std::vector<::sqlpp::chrono::microsecond_point>{start, start + std::chrono::hours{2}};
+      require_equal(__LINE__, db(by_time).front().count.value(), 2);
+
+      // The model has no uuid column, the parameter is named by the alias instead
+      auto by_uuid = db.prepare(select(tab.alpha)
+                                    .from(tab)
+                                    .where(sqlpp::postgresql::in_array(sqlpp::verbatim<sqlpp::uuid>("c_uuid"),
+                                                                       sqlpp::alias::u))
+                                    .order_by(tab.alpha.asc()));
+      boost::uuids::string_generator to_uuid;
+      by_uuid.params.u = std::vector<boost::uuids::uuid>{to_uuid("00000000-0000-0000-0000-000000000042"),
+                                                        to_uuid("00000000-0000-0000-0000-000000000013"),
+                                                        to_uuid("ffffffff-0000-0000-0000-000000000001")};
+      alphas.clear();
+      for (const auto& row : db(by_uuid))
+      {
+        alphas.push_back(row.alpha.value());
+      }
+      require_equal(__LINE__, static_cast<int>(alphas.size()), 2);
+      require_equal(__LINE__, alphas[0], 13);
+      require_equal(__LINE__, alphas[1], 42);
+      by_uuid.params.u = std::vector<boost::uuids::uuid>{};
+      for (const auto& row : db(by_uuid))
+      {
+        throw std::runtime_error("Unexpected row " + std::to_string(row.alpha.value()));
+      }
+
+      // not_in_array deletes everything else
+      auto keep = db.prepare(remove_from(tab).where(sqlpp::postgresql::not_in_array(tab.alpha)));
+      keep.params.alpha = std::vector<int64_t>{10, 20, 30};
+      require_equal(__LINE__, static_cast<int>(db(keep)), 97);
+      require_equal(__LINE__, db(select(count(tab.alpha)).from(tab).unconditionally()).front().count.value(), 3);
+    }
+  }
+  catch (const sql::failure& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
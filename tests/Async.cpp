@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "TabFoo.h"
+#include <sqlpp11/postgresql/postgresql.h>
+#include <sqlpp11/sqlpp11.h>
+
+#include <iostream>
+
+namespace
+{
+  template <typename L, typename R>
+  void require_equal(int line, const L& l, const R& r)
+  {
+    if (l != r)
+    {
+      std::cerr << line << ": ";
+      serialize(::sqlpp::wrap_operand_t<L>{l}, std::cerr);
+      std::cerr << " != ";
+      serialize(::sqlpp::wrap_operand_t<R>{r}, std::cerr);
+      throw std::runtime_error("Unexpected result");
+    }
+  }
+}
+
+namespace sql = sqlpp::postgresql;
+int Async(int, char*[])
+{
+  auto config = std::make_shared<sql::connection_config>();
+
+#ifdef WIN32
+  config->dbname = "test";
+  config->user = "test";
+  config->password = "test";
+  config->debug = true;
+#else
+  // TODO: assume there is a DB with the "username" as a name and the current user has "peer" access rights
+  config->dbname = getenv("USER");
+  config->user = config->dbname;
+  config->debug = false;
+#endif
+
+  try
+  {
+    sql::connection db(config);
+    db.execute(R"(DROP TABLE IF EXISTS tabfoo;)");
+    db.execute(R"(CREATE TABLE tabfoo
+                 (
+                   alpha bigserial NOT NULL,
+                   beta smallint,
+                   gamma text,
+                   c_bool boolean,
+                   c_timepoint timestamp with time zone,
+                   c_day date
+                 ))");
+
+    model::TabFoo tab = {};
+
+    // Affected rows
+    auto inserted = db.async_insert(insert_into(tab).set(tab.beta = 1, tab.gamma = "one"));
+    while (!inserted.ready())
+    {
+    }
+    require_equal(__LINE__, inserted.affected_rows(), 1u);
+    require_equal(__LINE__, db.async_insert(insert_into(tab).set(tab.beta = 2, tab.gamma = "two")).affected_rows(), 1u);
+    require_equal(__LINE__, db.async_update(update(tab).set(tab.beta = 3).where(tab.beta == 2)).affected_rows(), 1u);
+
+    // Rows
+    auto selected = db.async_select(select(tab.beta, tab.gamma).from(tab).where(tab.beta == 3));
+    require_equal(__LINE__, selected.socket() >= 0, true);
+    auto rows = 0;
+    for (const auto& row : selected.get())
+    {
+      ++rows;
+      require_equal(__LINE__, row.gamma.value(), "two");
+    }
+    require_equal(__LINE__, rows, 1);
+
+    // Several connections in flight at once
+    sql::connection other(config);
+    auto first = db.async_select(select(count(tab.alpha)).from(tab).unconditionally());
+    auto second = other.async_select(select(count(tab.alpha)).from(tab).where(tab.beta == 1));
+    while (!first.ready() || !second.ready())
+    {
+    }
+    require_equal(__LINE__, first.get().front().count.value(), 2);
+    require_equal(__LINE__, second.get().front().count.value(), 1);
+
+    // Prepared statements
+    auto prepared = db.prepare(select(tab.gamma).from(tab).where(tab.beta == parameter(tab.beta)));
+    prepared.params.beta = 1;
+    require_equal(__LINE__, db.async_run_prepared_select(prepared).get().front().gamma.value(), "one");
+    auto removal = db.prepare(remove_from(tab).where(tab.beta == parameter(tab.beta)));
+    removal.params.beta = 3;
+    require_equal(__LINE__, db.async_run_prepared_remove(removal).affected_rows(), 1u);
+
+    // Errors are reported when the result is accessed, the connection can be used right after
+    auto failing = db.async_select(select(tab.alpha).from(tab).where(tab.alpha / (tab.alpha - tab.alpha) > 0));
+    try
+    {
+      failing.get();
+      throw std::runtime_error("Expected the division by zero to be reported");
+    }
+    catch (const sql::sql_error&)
+    {
+    }
+    require_equal(__LINE__, db(select(count(tab.alpha)).from(tab).unconditionally()).front().count.value(), 1);
+  }
+  catch (const sql::failure& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "TabFoo.h"
+#include <sqlpp11/postgresql/postgresql.h>
+#include <sqlpp11/sqlpp11.h>
+
+#include <iostream>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+  template <typename L, typename R>
+  void require_equal(int line, const L& l, const R& r)
+  {
+    if (l != r)
+    {
+      std::cerr << line << ": ";
+      serialize(::sqlpp::wrap_operand_t<L>{l}, std::cerr);
+      std::cerr << " != ";
+      serialize(::sqlpp::wrap_operand_t<R>{r}, std::cerr);
+      throw std::runtime_error("Unexpected result");
+    }
+  }
+
+  struct sum_alpha
+  {
+    int64_t& sum;
+
+    template <typename Row>
+    void operator()(const Row& row) const
+    {
+      sum += row.alpha.value();
+    }
+  };
+}
+
+namespace sql = sqlpp::postgresql;
+int BatchInsert(int, char*[])
+{
+  auto config = std::make_shared<sql::connection_config>();
+
+#ifdef WIN32
+  config->dbname = "test";
+  config->user = "test";
+  config->password = "test";
+  config->debug = true;
+#else
+  // TODO: assume there is a DB with the "username" as a name and the current user has "peer" access rights
+  config->dbname = getenv("USER");
+  config->user = config->dbname;
+  config->debug = false;
+#endif
+
+  try
+  {
+    sql::connection db(config);
+    db.execute(R"(DROP TABLE IF EXISTS tabfoo;)");
+    db.execute(R"(CREATE TABLE tabfoo
+                 (
+                   alpha bigserial PRIMARY KEY,
+                   beta smallint,
+                   gamma text,
+                   c_bool boolean,
+                   c_timepoint timestamp with time zone,
+                   c_day date
+                 ))");
+
+    model::TabFoo tab = {};
+
+    // 1000 rows are inserted in batches of 512, 256, 128, 64, 32 and 8 rows
+    std::vector<std::tuple<int64_t, int, std::string>> rows;
+    for (int i = 1; i <= 1000; ++i)
+    {
+      rows.emplace_back(i, i % 100, "row " + std::to_string(i));
+    }
+    auto batch = db.batch_insert(sql::insert_into(tab), tab.alpha, tab.beta, tab.gamma);
+    require_equal(__LINE__, batch.run(rows), 1000u);
+    require_equal(__LINE__, db(select(count(tab.alpha)).from(tab).where(tab.gamma == "row 777")).front().count.value(),
+                  1);
+
+    // Null values
+    auto nulls = db.batch_insert(sql::insert_into(tab), tab.beta, tab.gamma);
+    require_equal(__LINE__, nulls.run(std::vector<std::tuple<int, sqlpp::null_t>>{{1, sqlpp::null}, {2, sqlpp::null}}),
+                  2u);
+    require_equal(__LINE__, db(select(count(tab.alpha)).from(tab).where(tab.gamma.is_null())).front().count.value(), 2);
+
+    // Conflicting rows are skipped
+    auto skipping = db.batch_insert(sql::insert_into(tab).on_conflict(tab.alpha).do_nothing(), tab.alpha, tab.gamma);
+    skipping.max_rows(4);
+    require_equal(__LINE__,
+                  skipping.run(std::vector<std::tuple<int64_t, std::string>>{
+                      {999, "again"}, {1000, "again"}, {2001, "new"}, {2002, "new"}, {2003, "new"}}),
+                  3u);
+
+    // Returned rows are handed to the callback
+    auto returning = db.batch_insert(sql::insert_into(tab).returning(tab.alpha), tab.alpha, tab.gamma);
+    int64_t sum = 0;
+    const auto returned = returning.run(
+        std::vector<std::tuple<int64_t, std::string>>{{3001, "returned"}, {3002, "returned"}, {3003, "returned"}},
+        sum_alpha{sum});
+    require_equal(__LINE__, returned, 3u);
+    require_equal(__LINE__, sum, 9006);
+
+    // Each batch is a statement of its own, outside a transaction the batches before a failing one stay inserted
+    auto pairs = db.batch_insert(sql::insert_into(tab), tab.alpha, tab.gamma);
+    try
+    {
+      pairs.run(std::vector<std::tuple<int64_t, std::string>>{{4001, "kept"}, {4002, "kept"}, {1, "duplicate"}});
+      throw std::runtime_error("Expected the duplicate key to be reported");
+    }
+    catch (const sql::failure&)
+    {
+    }
+    require_equal(__LINE__, db(select(count(tab.alpha)).from(tab).where(tab.gamma == "kept")).front().count.value(), 2);
+
+    // Within a transaction none of them are
+    {
+      auto tx = start_transaction(db);
+      try
+      {
+        pairs.run(
+            std::vector<std::tuple<int64_t, std::string>>{{5001, "rolled back"}, {5002, "rolled back"}, {1, "duplicate"}});
+        throw std::runtime_error("Expected the duplicate key to be reported");
+      }
+      catch (const sql::failure&)
+      {
+      }
+      tx.rollback();
+    }
+    require_equal(__LINE__,
+                  db(select(count(tab.alpha)).from(tab).where(tab.gamma == "rolled back")).front().count.value(), 0);
+  }
+  catch (const sql::failure& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
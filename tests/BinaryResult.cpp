@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "TabFoo.h"
+#include <sqlpp11/postgresql/postgresql.h>
+#include <sqlpp11/sqlpp11.h>
+
+#include <iostream>
+#include <limits>
+
+namespace
+{
+  template <typename L, typename R>
+  void require_equal(int line, const L& l, const R& r)
+  {
+    if (l != r)
+    {
+      std::cerr << line << ": ";
+      serialize(::sqlpp::wrap_operand_t<L>{l}, std::cerr);
+      std::cerr << " != ";
+      serialize(::sqlpp::wrap_operand_t<R>{r}, std::cerr);
+      throw std::runtime_error("Unexpected result");
+    }
+  }
+}
+
+namespace sql = sqlpp::postgresql;
+int BinaryResult(int, char*[])
+{
+  auto config = std::make_shared<sql::connection_config>();
+
+#ifdef WIN32
+  config->dbname = "test";
+  config->user = "test";
+  config->password = "test";
+  config->debug = true;
+#else
+  // TODO: assume there is a DB with the "username" as a name and the current user has "peer" access rights
+  config->dbname = getenv("USER");
+  config->user = config->dbname;
+  config->debug = true;
+#endif
+  config->binary_results = true;
+  config->binary_parameters = true;
+
+  try
+  {
+    sql::connection db(config);
+    db.execute(R"(SET TIME ZONE 'UTC';)");
+    db.execute(R"(DROP TABLE IF EXISTS tabfoo;)");
+    db.execute(R"(CREATE TABLE tabfoo
+                 (
+                   alpha bigserial NOT NULL,
+                   beta smallint,
+                   gamma text,
+                   c_bool boolean,
+                   c_timepoint timestamp with time zone,
+                   c_day date
+                 ))");
+
+    model::TabFoo tab = {};
+    db(insert_into(tab).default_values());
+    db.execute(
+        R"(INSERT INTO tabfoo (beta, gamma, c_bool, c_timepoint, c_day)
+           VALUES (-17, 'binary', true, '2019-04-01 12:34:56.789012+00', '1999-12-31'))");
+
+    auto prepared_select = db.prepare(select(all_of(tab)).from(tab).unconditionally().order_by(tab.alpha.asc()));
+    auto rows = 0;
+    for (const auto& row : db(prepared_select))
+    {
+      ++rows;
+      require_equal(__LINE__, row.alpha.value(), rows);
+      if (rows == 1)
+      {
+        require_equal(__LINE__, row.beta.is_null(), true);
+        require_equal(__LINE__, row.gamma.is_null(), true);
+        require_equal(__LINE__, row.c_bool.is_null(), true);
+        require_equal(__LINE__, row.c_timepoint.is_null(), true);
+        require_equal(__LINE__, row.c_day.is_null(), true);
+      }
+      else
+      {
+        const auto day = ::sqlpp::chrono::day_point{::date::year(1999) / 12 / 31};
+        const auto timepoint = ::sqlpp::chrono::day_point{::date::year(2019) / 4 / 1} + std::chrono::hours(12) +
+                               std::chrono::minutes(34) + std::chrono::seconds(56) +
+                               std::chrono::microseconds(789012);
+        require_equal(__LINE__, row.beta.value(), -17);
+        require_equal(__LINE__, row.gamma.value(), "binary");
+        require_equal(__LINE__, row.c_bool.value(), true);
+        require_equal(__LINE__, row.c_timepoint.value(), timepoint);
+        require_equal(__LINE__, row.c_day.value(), day);
+      }
+    }
+    require_equal(__LINE__, rows, 2);
+
+    // Aggregates come back as int8 and numeric
+    auto prepared_aggregate = db.prepare(select(count(tab.alpha), avg(tab.beta)).from(tab).unconditionally());
+    auto aggregates = db(prepared_aggregate);
+    const auto& aggregate = aggregates.front();
+    require_equal(__LINE__, aggregate.count.value(), 2);
+    require_equal(__LINE__, aggregate.avg.value(), -17.0);
+
+    // Round trip of binary parameters
+    const auto day = ::sqlpp::chrono::day_point{::date::year(1969) / 7 / 20};
+    const auto timepoint = ::date::floor<::std::chrono::microseconds>(std::chrono::system_clock::now());
+    auto prepared_update = db.prepare(update(tab)
+                                          .set(tab.beta = parameter(tab.beta), tab.c_bool = parameter(tab.c_bool),
+                                               tab.c_timepoint = parameter(tab.c_timepoint),
+                                               tab.c_day = parameter(tab.c_day))
+                                          .where(tab.alpha == parameter(tab.alpha)));
+    prepared_update.params.alpha = 1;
+    prepared_update.params.beta = 4711;
+    prepared_update.params.c_bool = false;
+    prepared_update.params.c_timepoint = timepoint;
+    prepared_update.params.c_day = day;
+    require_equal(__LINE__, db(prepared_update), 1);
+
+    auto prepared_lookup = db.prepare(select(all_of(tab)).from(tab).where(tab.alpha == parameter(tab.alpha)));
+    prepared_lookup.params.alpha = 1;
+    auto lookup = db(prepared_lookup);
+    require_equal(__LINE__, lookup.front().beta.value(), 4711);
+    require_equal(__LINE__, lookup.front().c_bool.value(), false);
+    require_equal(__LINE__, lookup.front().c_timepoint.value(), timepoint);
+    require_equal(__LINE__, lookup.front().c_day.value(), day);
+
+    // +/-infinity are bound as the largest and smallest values, in both formats
+    db.execute(R"(INSERT INTO tabfoo (beta, gamma, c_timepoint, c_day)
+                  VALUES (1, 'infinity', 'infinity', 'infinity'), (-1, 'infinity', '-infinity', '-infinity'))");
+    auto text_config = std::make_shared<sql::connection_config>(*config);
+    text_config->binary_results = false;
+    sql::connection text_db(text_config);
+    for (auto* connection : {&db, &text_db})
+    {
+      auto prepared_infinite = connection->prepare(
+          select(tab.c_timepoint, tab.c_day).from(tab).where(tab.gamma == "infinity").order_by(tab.beta.desc()));
+      auto infinite = (*connection)(prepared_infinite);
+      require_equal(__LINE__, infinite.front().c_timepoint.value() == ::sqlpp::chrono::microsecond_point::max(), true);
+      require_equal(__LINE__, infinite.front().c_day.value() == ::sqlpp::chrono::day_point::max(), true);
+      infinite.pop_front();
+      require_equal(__LINE__, infinite.front().c_timepoint.value() == ::sqlpp::chrono::microsecond_point::min(), true);
+      require_equal(__LINE__, infinite.front().c_day.value() == ::sqlpp::chrono::day_point::min(), true);
+    }
+
+    // Integers beyond the range of int64_t are clamped to it, also the ones that still fit into uint64_t
+    const auto huge_value = sqlpp::verbatim<sqlpp::integral>("12345678901234567890123::numeric");
+    const auto huge_negative = sqlpp::verbatim<sqlpp::integral>("(-12345678901234567890123)::numeric");
+    const auto unsigned_value = sqlpp::verbatim<sqlpp::integral>("10000000000000000000::numeric");
+    for (auto* connection : {&db, &text_db})
+    {
+      auto prepared_huge = connection->prepare(select(
+          huge_value.as(sqlpp::alias::a), huge_negative.as(sqlpp::alias::b), unsigned_value.as(sqlpp::alias::c)));
+      auto huge = (*connection)(prepared_huge);
+      require_equal(__LINE__, huge.front().a.value() == std::numeric_limits<int64_t>::max(), true);
+      require_equal(__LINE__, huge.front().b.value() == std::numeric_limits<int64_t>::min(), true);
+      require_equal(__LINE__, huge.front().c.value() == std::numeric_limits<int64_t>::max(), true);
+    }
+  }
+  catch (const sql::failure& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "TabFoo.h"
+#include <sqlpp11/postgresql/postgresql.h>
+#include <sqlpp11/sqlpp11.h>
+
+#include <iostream>
+
+namespace
+{
+  template <typename L, typename R>
+  void require_equal(int line, const L& l, const R& r)
+  {
+    if (l != r)
+    {
+      std::cerr << line << ": ";
+      serialize(::sqlpp::wrap_operand_t<L>{l}, std::cerr);
+      std::cerr << " != ";
+      serialize(::sqlpp::wrap_operand_t<R>{r}, std::cerr);
+      throw std::runtime_error("Unexpected result");
+    }
+  }
+}
+
+namespace sql = sqlpp::postgresql;
+int ColumnBatch(int, char*[])
+{
+  auto config = std::make_shared<sql::connection_config>();
+
+#ifdef WIN32
+  config->dbname = "test";
+  config->user = "test";
+  config->password = "test";
+  config->debug = true;
+#else
+  // TODO: assume there is a DB with the "username" as a name and the current user has "peer" access rights
+  config->dbname = getenv("USER");
+  config->user = config->dbname;
+  config->debug = false;
+#endif
+
+  try
+  {
+    for (const auto binary_results : {false, true})
+    {
+      config->binary_results = binary_results;
+      sql::connection db(config);
+      db.execute(R"(SET TIME ZONE 'UTC';)");
+      db.execute(R"(DROP TABLE IF EXISTS tabfoo;)");
+      db.execute(R"(CREATE TABLE tabfoo
+                   (
+                     alpha bigserial NOT NULL,
+                     beta smallint,
+                     gamma text,
+                     c_bool boolean,
+                     c_timepoint timestamp with time zone,
+                     c_day date
+                   ))");
+      db.execute(R"(INSERT INTO tabfoo (beta, gamma, c_bool, c_timepoint, c_day)
+                    SELECT CASE WHEN i % 3 = 0 THEN NULL ELSE i % 10 END, 'row ' || i, i % 2 = 0,
+                           '2020-01-01 00:00:00+00'::timestamptz + i * interval '1 second', DATE '2020-01-01' + i
+                    FROM generate_series(1, 100) i)");
+
+      model::TabFoo tab = {};
+      auto prepared = db.prepare(select(tab.alpha, tab.beta, tab.gamma, tab.c_bool, tab.c_timepoint, tab.c_day)
+                                     .from(tab)
+                                     .where(tab.alpha <= parameter(tab.alpha))
+                                     .order_by(tab.alpha.asc()));
+      prepared.params.alpha = 100;
+      auto result = db.run_prepared_select(prepared);
+
+      // Chunks that do not divide the result evenly, the buffers are reused between them
+      sql::column_batch_t batch;
+      int64_t rows = 0;
+      int64_t alpha_sum = 0;
+      int64_t beta_sum = 0;
+      int64_t nulls = 0;
+      while (const auto chunk = result.fetch_columns(batch, 7))
+      {
+        require_equal(__LINE__, static_cast<int>(batch.columns.size()), 6);
+        require_equal(__LINE__, batch.columns[0].name, std::string{"alpha"});
+        require_equal(__LINE__, batch.columns[0].kind == sql::result_column_t::kind_t::integral, true);
+        require_equal(__LINE__, batch.columns[2].kind == sql::result_column_t::kind_t::text, true);
+        require_equal(__LINE__, batch.columns[5].kind == sql::result_column_t::kind_t::date, true);
+        for (size_t row = 0; row < chunk; ++row)
+        {
+          const auto alpha = batch.columns[0].integrals[row];
+          require_equal(__LINE__, alpha, rows + 1);
+          alpha_sum += alpha;
+          beta_sum += batch.columns[1].integrals[row];
+          nulls += batch.columns[1].is_null(row);
+          require_equal(__LINE__, batch.columns[1].is_null(row), alpha % 3 == 0);
+          require_equal(__LINE__,
+                        std::string(batch.columns[2].text(row), batch.columns[2].text_size(row)),
+                        "row " + std::to_string(alpha));
+          require_equal(__LINE__, batch.columns[3].booleans[row] != 0, alpha % 2 == 0);
+          require_equal(__LINE__, batch.columns[4].date_times[row],
+                        ::sqlpp::chrono::microsecond_point{::sqlpp::chrono::day_point{::date::year{2020} / 1 / 1} +
+                                                           std::chrono::seconds{alpha}});
+          require_equal(__LINE__, batch.columns[5].dates[row],
+                        ::sqlpp::chrono::day_point{::date::year{2020} / 1 / 1} + ::sqlpp::chrono::days{alpha});
+          ++rows;
+        }
+      }
+      require_equal(__LINE__, rows, 100);
+      require_equal(__LINE__, alpha_sum, 5050);
+      require_equal(__LINE__, nulls, 33);
+
+      int64_t expected_beta_sum = 0;
+      for (int64_t i = 1; i <= 100; ++i)
+      {
+        expected_beta_sum += i % 3 == 0 ? 0 : i % 10;
+      }
+      require_equal(__LINE__, beta_sum, expected_beta_sum);
+
+      // A direct select, decoded at once
+      auto rest = db.select(select(tab.alpha).from(tab).where(tab.alpha > 90).order_by(tab.alpha.asc()));
+      require_equal(__LINE__, static_cast<int>(rest.fetch_columns(batch)), 10);
+      require_equal(__LINE__, static_cast<int>(batch.columns.size()), 1);
+      require_equal(__LINE__, batch.columns[0].integrals.back(), 100);
+      require_equal(__LINE__, static_cast<int>(rest.fetch_columns(batch)), 0);
+    }
+  }
+  catch (const sql::failure& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "TabFoo.h"
+#include <sqlpp11/postgresql/postgresql.h>
+#include <sqlpp11/sqlpp11.h>
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  template <typename L, typename R>
+  void require_equal(int line, const L& l, const R& r)
+  {
+    if (l != r)
+    {
+      std::cerr << line << ": ";
+      serialize(::sqlpp::wrap_operand_t<L>{l}, std::cerr);
+      std::cerr << " != ";
+      serialize(::sqlpp::wrap_operand_t<R>{r}, std::cerr);
+      throw std::runtime_error("Unexpected result");
+    }
+  }
+}
+
+namespace sql = sqlpp::postgresql;
+int ConnectionPool(int, char*[])
+{
+  auto config = std::make_shared<sql::connection_config>();
+
+#ifdef WIN32
+  config->dbname = "test";
+  config->user = "test";
+  config->password = "test";
+  config->debug = true;
+#else
+  // TODO: assume there is a DB with the "username" as a name and the current user has "peer" access rights
+  config->dbname = getenv("USER");
+  config->user = config->dbname;
+  config->debug = false;
+#endif
+
+  try
+  {
+    sql::connection_pool pool(config, 4);
+    {
+      auto db = pool.get();
+      db->execute(R"(DROP TABLE IF EXISTS tabfoo;)");
+      db->execute(R"(CREATE TABLE tabfoo
+                   (
+                     alpha bigserial NOT NULL,
+                     beta smallint,
+                     gamma text,
+                     c_bool boolean,
+                     c_timepoint timestamp with time zone,
+                     c_day date
+                   ))");
+    }
+    require_equal(__LINE__, pool.size(), 1);
+    require_equal(__LINE__, pool.idle(), 1);
+
+    // More threads than connections
+    model::TabFoo tab = {};
+    std::atomic<int> failures{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 16; ++t)
+    {
+      threads.emplace_back([&pool, &tab, &failures, t] {
+        try
+        {
+          for (int i = 0; i < 20; ++i)
+          {
+            auto db = pool.get();
+            (*db)(insert_into(tab).set(tab.beta = t, tab.gamma = "pooled"));
+          }
+        }
+        catch (const std::exception& e)
+        {
+          std::cerr << "Exception: " << e.what() << std::endl;
+          ++failures;
+        }
+      });
+    }
+    for (auto& thread : threads)
+    {
+      thread.join();
+    }
+    require_equal(__LINE__, failures.load(), 0);
+    require_equal(__LINE__, pool.size() <= 4, true);
+    {
+      auto db = pool.get();
+      require_equal(__LINE__, (*db)(select(count(tab.alpha)).from(tab).unconditionally()).front().count.value(), 320);
+    }
+
+    // Connections left in a transaction or invalidated are not reused
+    const auto before = pool.size();
+    {
+      auto db = pool.get();
+      db->start_transaction();
+    }
+    {
+      auto db = pool.get();
+      db.invalidate();
+    }
+    require_equal(__LINE__, pool.size() <= before, true);
+
+    // Waiting for a connection times out
+    sql::connection_pool single(config, 1);
+    auto taken = single.get();
+    try
+    {
+      single.get(std::chrono::milliseconds(10));
+      throw std::runtime_error("Expected the pool to be exhausted");
+    }
+    catch (const sqlpp::exception&)
+    {
+    }
+
+    // Idle connections are reaped
+    sql::connection_pool reaping(config, 2, std::chrono::milliseconds(0));
+    {
+      auto db = reaping.get();
+    }
+    reaping.reap_idle();
+    require_equal(__LINE__, reaping.size(), 0);
+  }
+  catch (const sql::failure& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "TabFoo.h"
+#include <sqlpp11/postgresql/postgresql.h>
+#include <sqlpp11/sqlpp11.h>
+
+#include <iostream>
+
+namespace
+{
+  template <typename L, typename R>
+  void require_equal(int line, const L& l, const R& r)
+  {
+    if (l != r)
+    {
+      std::cerr << line << ": ";
+      serialize(::sqlpp::wrap_operand_t<L>{l}, std::cerr);
+      std::cerr << " != ";
+      serialize(::sqlpp::wrap_operand_t<R>{r}, std::cerr);
+      throw std::runtime_error("Unexpected result");
+    }
+  }
+}
+
+namespace sql = sqlpp::postgresql;
+int Copy(int, char*[])
+{
+  auto config = std::make_shared<sql::connection_config>();
+
+#ifdef WIN32
+  config->dbname = "test";
+  config->user = "test";
+  config->password = "test";
+  config->debug = true;
+#else
+  // TODO: assume there is a DB with the "username" as a name and the current user has "peer" access rights
+  config->dbname = getenv("USER");
+  config->user = config->dbname;
+  config->debug = false;
+#endif
+
+  try
+  {
+    sql::connection db(config);
+    db.execute(R"(SET TIME ZONE 'UTC';)");
+    db.execute(R"(DROP TABLE IF EXISTS tabfoo;)");
+    db.execute(R"(CREATE TABLE tabfoo
+                 (
+                   alpha bigserial NOT NULL,
+                   beta smallint,
+                   gamma text,
+                   c_bool boolean,
+                   c_timepoint timestamp with time zone,
+                   c_day date
+                 ))");
+
+    model::TabFoo tab = {};
+    const auto day = ::sqlpp::chrono::day_point{::date::year(2020) / 2 / 29};
+    const auto timepoint = day + std::chrono::hours(23) + std::chrono::microseconds(1);
+
+    auto copy = db.copy_in(tab, tab.alpha, tab.beta, tab.gamma, tab.c_bool, tab.c_timepoint, tab.c_day);
+    for (int i = 1; i <= 10000; ++i)
+    {
+      copy.push(i, i % 100, "row " + std::to_string(i), i % 2 == 0, timepoint, day);
+    }
+    copy.push(10001, sqlpp::null, sqlpp::null, sqlpp::null, sqlpp::null, sqlpp::null);
+    require_equal(__LINE__, copy.finish(), 10001);
+
+    require_equal(__LINE__, db(select(count(tab.alpha)).from(tab).unconditionally()).front().count.value(), 10001);
+    auto rows = db(select(all_of(tab)).from(tab).where(tab.alpha == 42));
+    const auto& row = rows.front();
+    require_equal(__LINE__, row.beta.value(), 42);
+    require_equal(__LINE__, row.gamma.value(), "row 42");
+    require_equal(__LINE__, row.c_bool.value(), true);
+    require_equal(__LINE__, row.c_timepoint.value(), timepoint);
+    require_equal(__LINE__, row.c_day.value(), day);
+    auto nulls = db(select(all_of(tab)).from(tab).where(tab.alpha == 10001));
+    require_equal(__LINE__, nulls.front().gamma.is_null(), true);
+    require_equal(__LINE__, nulls.front().c_day.is_null(), true);
+
+    // Read it back through COPY TO STDOUT, in small chunks
+    auto count = 0;
+    for (const auto& copied : db.copy_out(select(all_of(tab)).from(tab).unconditionally().order_by(tab.alpha.asc()), 7))
+    {
+      ++count;
+      require_equal(__LINE__, copied.alpha.value(), count);
+      if (count <= 10000)
+      {
+        require_equal(__LINE__, copied.beta.value(), count % 100);
+        require_equal(__LINE__, copied.gamma.value(), "row " + std::to_string(count));
+        require_equal(__LINE__, copied.c_bool.value(), count % 2 == 0);
+        require_equal(__LINE__, copied.c_timepoint.value(), timepoint);
+        require_equal(__LINE__, copied.c_day.value(), day);
+      }
+      else
+      {
+        require_equal(__LINE__, copied.beta.is_null(), true);
+        require_equal(__LINE__, copied.c_timepoint.is_null(), true);
+      }
+    }
+    require_equal(__LINE__, count, 10001);
+
+    // Leaving early cancels the COPY
+    count = 0;
+    for (const auto& copied : db.copy_out(select(tab.alpha).from(tab).unconditionally()))
+    {
+      (void)copied;
+      if (++count == 5)
+      {
+        break;
+      }
+    }
+
+    // Out of range for smallint: the COPY is aborted when the loader goes out of scope
+    try
+    {
+      auto failing = db.copy_in(tab, tab.beta);
+      failing.push(100000);
+      throw std::runtime_error("Expected the out of range value to be rejected");
+    }
+    catch (const sqlpp::exception&)
+    {
+    }
+    require_equal(__LINE__, db(select(count(tab.alpha)).from(tab).unconditionally()).front().count.value(), 10001);
+
+    // A row rejected halfway is dropped, the rows around it are still copied
+    auto partial = db.copy_in(tab, tab.alpha, tab.beta);
+    partial.push(20001, 1);
+    try
+    {
+      partial.push(20002, 100000);
+      throw std::runtime_error("Expected the out of range value to be rejected");
+    }
+    catch (const sqlpp::exception&)
+    {
+    }
+    partial.push(20003, 3);
+    require_equal(__LINE__, partial.finish(), 2);
+    require_equal(__LINE__, db(select(count(tab.alpha)).from(tab).unconditionally()).front().count.value(), 10003);
+  }
+  catch (const sql::failure& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -141,6 +141,21 @@ int DateTime(int, char*[])
       require_equal(__LINE__, row.c_day.value(), today);
       require_equal(__LINE__, row.c_timepoint.value(), now);
     }
+
+    // In UTC mode timestamp parameters round trip whatever the local time zone is
+    auto utc_config = std::make_shared<sql::connection_config>(*config);
+    utc_config->utc_timestamps = true;
+    sql::connection utc_db(utc_config);
+    utc_db.execute(R"(SET TIME ZONE 'UTC';)");
+    auto utc_update = utc_db.prepare(update(tab).set(tab.c_timepoint = parameter(tab.c_timepoint)).unconditionally());
+    const auto early_morning = ::sqlpp::chrono::microsecond_point{yesterday + std::chrono::hours{3}};
+    for (const auto& value : {now, early_morning})
+    {
+      utc_update.params.c_timepoint = value;
+      utc_db(utc_update);
+      require_equal(__LINE__, utc_db(select(tab.c_timepoint).from(tab).unconditionally()).front().c_timepoint.value(),
+                    value);
+    }
   }
   catch (const sql::failure& e)
   {
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "TabFoo.h"
+#include <sqlpp11/postgresql/postgresql.h>
+#include <sqlpp11/sqlpp11.h>
+
+#include <iostream>
+#include <libpq-fe.h>
+
+namespace
+{
+  template <typename L, typename R>
+  void require_equal(int line, const L& l, const R& r)
+  {
+    if (l != r)
+    {
+      std::cerr << line << ": ";
+      serialize(::sqlpp::wrap_operand_t<L>{l}, std::cerr);
+      std::cerr << " != ";
+      serialize(::sqlpp::wrap_operand_t<R>{r}, std::cerr);
+      throw std::runtime_error("Unexpected result");
+    }
+  }
+}
+
+namespace sql = sqlpp::postgresql;
+int Metrics(int, char*[])
+{
+  auto config = std::make_shared<sql::connection_config>();
+
+#ifdef WIN32
+  config->dbname = "test";
+  config->user = "test";
+  config->password = "test";
+  config->debug = true;
+#else
+  // TODO: assume there is a DB with the "username" as a name and the current user has "peer" access rights
+  config->dbname = getenv("USER");
+  config->user = config->dbname;
+  config->debug = false;
+#endif
+
+  config->metrics = true;
+
+  try
+  {
+    sql::connection db(config);
+    db.execute(R"(DROP TABLE IF EXISTS tabfoo;)");
+    db.execute(R"(CREATE TABLE tabfoo
+                 (
+                   alpha bigserial NOT NULL,
+                   beta smallint,
+                   gamma text,
+                   c_bool boolean,
+                   c_timepoint timestamp with time zone,
+                   c_day date
+                 ))");
+
+    // Statements that only differ in their literals share an entry
+    db.execute(R"(INSERT INTO tabfoo (beta, gamma) VALUES (1, 'one'))");
+    db.execute(R"(INSERT INTO tabfoo (beta, gamma) VALUES (2, 'it''s two'))");
+    db.execute(R"(UPDATE tabfoo SET gamma = 'three' WHERE beta IN (1, 2))");
+
+    auto snapshot = db.metrics();
+    const auto& insert = snapshot.statements.at("INSERT INTO tabfoo (beta, gamma) VALUES (?)");
+    require_equal(__LINE__, static_cast<int>(insert.execute.count), 2);
+    require_equal(__LINE__, static_cast<int>(insert.affected_rows), 2);
+    const auto& update = snapshot.statements.at("UPDATE tabfoo SET gamma = ? WHERE beta IN (?)");
+    require_equal(__LINE__, static_cast<int>(update.affected_rows), 2);
+
+    // Prepared statements record the prepare and each execution
+    model::TabFoo tab = {};
+    auto prepared = db.prepare(select(tab.alpha).from(tab).where(tab.beta > parameter(tab.beta)));
+    for (int beta = 0; beta < 3; ++beta)
+    {
+      prepared.params.beta = beta;
+      db(prepared);
+    }
+    snapshot = db.metrics();
+    bool found = false;
+    for (const auto& statement : snapshot.statements)
+    {
+      if (statement.second.prepare.count == 1 && statement.second.execute.count == 3)
+      {
+        found = true;
+        require_equal(__LINE__, static_cast<int>(statement.second.rows), 3);
+        // PQresultMemorySize came with libpq 12
+        require_equal(__LINE__, statement.second.result_bytes > 0 || PQlibVersion() < 120000, true);
+      }
+    }
+    require_equal(__LINE__, found, true);
+
+    // Failures are counted by SQLSTATE class
+    try
+    {
+      db.execute(R"(SELECT * FROM missing_table)");
+    }
+    catch (const sql::failure&)
+    {
+    }
+    snapshot = db.metrics();
+    require_equal(__LINE__, static_cast<int>(snapshot.statements.at("SELECT * FROM missing_table").errors.at("42")), 1);
+
+    // Snapshots of several connections merge into one
+    sql::connection other(config);
+    other.execute(R"(INSERT INTO tabfoo (beta, gamma) VALUES (3, 'three'))");
+    snapshot.merge(other.metrics());
+    require_equal(
+        __LINE__,
+        static_cast<int>(snapshot.statements.at("INSERT INTO tabfoo (beta, gamma) VALUES (?)").execute.count), 3);
+    const auto& histogram = snapshot.statements.at("INSERT INTO tabfoo (beta, gamma) VALUES (?)").execute;
+    require_equal(__LINE__, histogram.percentile(50) <= histogram.percentile(100), true);
+
+    // Without the flag nothing is recorded
+    auto plain = std::make_shared<sql::connection_config>(*config);
+    plain->metrics = false;
+    sql::connection unmeasured(plain);
+    unmeasured.execute(R"(SELECT 1)");
+    require_equal(__LINE__, unmeasured.metrics().statements.empty(), true);
+  }
+  catch (const sql::failure& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
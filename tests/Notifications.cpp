@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp11/postgresql/postgresql.h>
+#include <sqlpp11/sqlpp11.h>
+
+#include <chrono>
+#include <iostream>
+#include <libpq-fe.h>
+#include <string>
+#include <vector>
+
+namespace
+{
+  template <typename L, typename R>
+  void require_equal(int line, const L& l, const R& r)
+  {
+    if (l != r)
+    {
+      std::cerr << line << ": ";
+      serialize(::sqlpp::wrap_operand_t<L>{l}, std::cerr);
+      std::cerr << " != ";
+      serialize(::sqlpp::wrap_operand_t<R>{r}, std::cerr);
+      throw std::runtime_error("Unexpected result");
+    }
+  }
+}
+
+namespace sql = sqlpp::postgresql;
+int Notifications(int, char*[])
+{
+  auto config = std::make_shared<sql::connection_config>();
+
+#ifdef WIN32
+  config->dbname = "test";
+  config->user = "test";
+  config->password = "test";
+  config->debug = true;
+#else
+  // TODO: assume there is a DB with the "username" as a name and the current user has "peer" access rights
+  config->dbname = getenv("USER");
+  config->user = config->dbname;
+  config->debug = false;
+#endif
+
+  try
+  {
+    sql::connection db(config);
+    sql::connection other(config);
+
+    sql::notification_listener_t listener(db, {"cache", "Mixed Case"});
+    require_equal(__LINE__, static_cast<int>(listener.channels().size()), 2);
+
+    // Nothing arrives without a notification
+    require_equal(__LINE__, listener.poll().empty(), true);
+    require_equal(__LINE__, listener.wait(std::chrono::milliseconds{50}).empty(), true);
+
+    // Notifications of a transaction are delivered together when it commits
+    other.execute("BEGIN");
+    other.execute("NOTIFY cache, 'one'");
+    other.execute("NOTIFY \"Mixed Case\", 'two'");
+    other.execute("NOTIFY cache");
+    other.execute("COMMIT");
+
+    std::vector<sql::notification_t> received;
+    while (received.size() < 3)
+    {
+      const auto batch = listener.wait(std::chrono::seconds{5});
+      if (batch.empty())
+      {
+        throw std::runtime_error("Notifications did not arrive");
+      }
+      received.insert(received.end(), batch.begin(), batch.end());
+    }
+    require_equal(__LINE__, static_cast<int>(received.size()), 3);
+    require_equal(__LINE__, received[0].channel, std::string("cache"));
+    require_equal(__LINE__, received[0].payload, std::string("one"));
+    require_equal(__LINE__, received[1].channel, std::string("Mixed Case"));
+    require_equal(__LINE__, received[1].payload, std::string("two"));
+    require_equal(__LINE__, received[2].payload, std::string(""));
+
+    // Notifications that arrive while the connection runs other statements are kept for the next call
+    other.execute("NOTIFY cache, 'meanwhile'");
+    db.execute("SELECT pg_sleep(0.1)");
+    const auto kept = listener.wait(std::chrono::seconds{5});
+    require_equal(__LINE__, static_cast<int>(kept.size()), 1);
+    require_equal(__LINE__, kept.front().payload, std::string("meanwhile"));
+
+    // Channels that are not listened to anymore stay quiet
+    listener.unlisten("cache");
+    other.execute("NOTIFY cache, 'ignored'");
+    require_equal(__LINE__, listener.wait(std::chrono::milliseconds{100}).empty(), true);
+
+    // A lost connection is reported instead of waiting forever
+    {
+      sql::connection doomed(config);
+      sql::notification_listener_t lost(doomed, {"cache"});
+      other.execute("SELECT pg_terminate_backend(" + std::to_string(PQbackendPID(doomed.native_handle())) + ")");
+      try
+      {
+        lost.wait();
+        throw std::runtime_error("Expected the lost connection to be reported");
+      }
+      catch (const sqlpp::exception&)
+      {
+      }
+    }
+  }
+  catch (const sql::failure& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
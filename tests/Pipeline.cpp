@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "TabFoo.h"
+#include <sqlpp11/postgresql/postgresql.h>
+#include <sqlpp11/sqlpp11.h>
+
+#include <iostream>
+
+namespace
+{
+  template <typename L, typename R>
+  void require_equal(int line, const L& l, const R& r)
+  {
+    if (l != r)
+    {
+      std::cerr << line << ": ";
+      serialize(::sqlpp::wrap_operand_t<L>{l}, std::cerr);
+      std::cerr << " != ";
+      serialize(::sqlpp::wrap_operand_t<R>{r}, std::cerr);
+      throw std::runtime_error("Unexpected result");
+    }
+  }
+}
+
+namespace sql = sqlpp::postgresql;
+int Pipeline(int, char*[])
+{
+  auto config = std::make_shared<sql::connection_config>();
+
+#ifdef WIN32
+  config->dbname = "test";
+  config->user = "test";
+  config->password = "test";
+  config->debug = true;
+#else
+  // TODO: assume there is a DB with the "username" as a name and the current user has "peer" access rights
+  config->dbname = getenv("USER");
+  config->user = config->dbname;
+  config->debug = false;
+#endif
+
+  try
+  {
+    sql::connection db(config);
+    db.execute(R"(DROP TABLE IF EXISTS tabfoo;)");
+    db.execute(R"(CREATE TABLE tabfoo
+                 (
+                   alpha bigserial NOT NULL,
+                   beta smallint,
+                   gamma text,
+                   c_bool boolean,
+                   c_timepoint timestamp with time zone,
+                   c_day date
+                 ))");
+
+    model::TabFoo tab = {};
+    auto prepared_insert = db.prepare(insert_into(tab).set(tab.beta = parameter(tab.beta), tab.gamma = "prepared"));
+
+    {
+      sql::pipeline_t pipeline(db);
+      std::vector<sql::pipeline_entry_t> inserts;
+      for (int i = 0; i < 20; ++i)
+      {
+        inserts.push_back(pipeline.execute(insert_into(tab).set(tab.beta = i, tab.gamma = "direct")));
+        prepared_insert.params.beta = i;
+        inserts.push_back(pipeline.run_prepared(prepared_insert));
+      }
+      auto counted = pipeline.select(select(count(tab.alpha)).from(tab).unconditionally());
+      // Statements up to a sync run in one implicit transaction, an error rolls all of them back
+      pipeline.sync();
+      auto failing = pipeline.execute(insert_into(tab).set(tab.beta = 100000));
+      auto skipped = pipeline.execute(insert_into(tab).set(tab.beta = 1));
+      pipeline.sync();
+      auto after_sync = pipeline.select(select(tab.gamma).from(tab).where(tab.alpha == 2));
+
+      // Results are read in order, on access
+      require_equal(__LINE__, counted.get().front().count.value(), 40);
+      for (auto& insert : inserts)
+      {
+        require_equal(__LINE__, insert.affected_rows(), 1);
+      }
+      try
+      {
+        failing.affected_rows();
+        throw std::runtime_error("Expected the out of range value to be rejected");
+      }
+      catch (const sql::sql_error&)
+      {
+      }
+      try
+      {
+        skipped.affected_rows();
+        throw std::runtime_error("Expected the statement after the error to be skipped");
+      }
+      catch (const sql::sql_error&)
+      {
+      }
+      require_equal(__LINE__, after_sync.get().front().gamma.value(), "prepared");
+    }
+
+    // Regular statements work again once the pipeline is finished
+    require_equal(__LINE__, db(select(count(tab.alpha)).from(tab).unconditionally()).front().count.value(), 40);
+  }
+  catch (const sql::failure& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -152,6 +152,18 @@ int Select(int argc, char* argv[])
   assert(not db(select(tab.c_bool).from(tab).where(tab.gamma == "asdfg")).front().c_bool);
   assert(not db(select(tab.c_bool).from(tab).where(tab.alpha == 1)).front().c_bool);
 
+  // test escaped text, serialized through one context reused for several statements
+  {
+    sql::context_t context(db);
+    for (const auto text : {"it's", "back\\slash", "it''s \\'"})
+    {
+      context.reset();
+      serialize(insert_into(tab).set(tab.c_bool = true, tab.gamma = text), context);
+      db.execute(context.str());
+      assert(db(select(tab.gamma).from(tab).where(tab.gamma == text)).front().gamma == text);
+    }
+  }
+
   // test
 
   // update
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "TabFoo.h"
+#include <sqlpp11/postgresql/postgresql.h>
+#include <sqlpp11/sqlpp11.h>
+
+#include <iostream>
+#include <libpq-events.h>
+
+namespace
+{
+  // Results libpq created for the connection and that are not freed yet
+  int live_results = 0;
+
+  int count_results(PGEventId id, void*, void*)
+  {
+    if (id == PGEVT_RESULTCREATE)
+    {
+      ++live_results;
+    }
+    else if (id == PGEVT_RESULTDESTROY)
+    {
+      --live_results;
+    }
+    return 1;
+  }
+
+  template <typename L, typename R>
+  void require_equal(int line, const L& l, const R& r)
+  {
+    if (l != r)
+    {
+      std::cerr << line << ": ";
+      serialize(::sqlpp::wrap_operand_t<L>{l}, std::cerr);
+      std::cerr << " != ";
+      serialize(::sqlpp::wrap_operand_t<R>{r}, std::cerr);
+      throw std::runtime_error("Unexpected result");
+    }
+  }
+}
+
+namespace sql = sqlpp::postgresql;
+int StatementCache(int, char*[])
+{
+  auto config = std::make_shared<sql::connection_config>();
+
+#ifdef WIN32
+  config->dbname = "test";
+  config->user = "test";
+  config->password = "test";
+  config->debug = true;
+#else
+  // TODO: assume there is a DB with the "username" as a name and the current user has "peer" access rights
+  config->dbname = getenv("USER");
+  config->user = config->dbname;
+  config->debug = false;
+#endif
+
+  config->statement_cache_size = 2;
+  config->deallocate_batch_size = 1;
+
+  try
+  {
+    sql::connection db(config);
+    db.execute(R"(DROP TABLE IF EXISTS tabfoo;)");
+    db.execute(R"(CREATE TABLE tabfoo
+                 (
+                   alpha bigserial NOT NULL,
+                   beta smallint,
+                   gamma text,
+                   c_bool boolean,
+                   c_timepoint timestamp with time zone,
+                   c_day date
+                 ))");
+    db.execute(R"(INSERT INTO tabfoo (beta, gamma) SELECT i % 10, 'row ' || i FROM generate_series(1, 100) i)");
+
+    model::TabFoo tab = {};
+    auto prepared_statements = [&db]() {
+      return db(select(sqlpp::verbatim<sqlpp::integral>("(SELECT count(*) FROM pg_prepared_statements)")
+                           .as(sqlpp::alias::a)))
+          .front()
+          .a.value();
+    };
+
+    // Released statements stay prepared and are reused
+    for (int beta = 0; beta < 3; ++beta)
+    {
+      auto prepared = db.prepare(select(tab.alpha).from(tab).where(tab.beta == parameter(tab.beta)));
+      prepared.params.beta = beta;
+      auto rows = 0;
+      for (const auto& row : db(prepared))
+      {
+        ++rows;
+        require_equal(__LINE__, row.alpha.value() % 10, beta);
+      }
+      require_equal(__LINE__, rows, 10);
+    }
+    require_equal(__LINE__, prepared_statements(), 1);
+
+    // Memoized statements are serialized once and still bind their parameters
+    for (int beta = 0; beta < 3; ++beta)
+    {
+      auto prepared = db.prepare_memoized(select(tab.alpha).from(tab).where(tab.beta == parameter(tab.beta)));
+      prepared.params.beta = beta;
+      require_equal(__LINE__, db(prepared).front().alpha.value() % 10, beta);
+      require_equal(
+          __LINE__,
+          db.run_memoized(select(count(tab.alpha)).from(tab).unconditionally()).front().count.value(), 100);
+    }
+    require_equal(__LINE__, prepared_statements(), 1);
+
+    // A statement in use is not handed out twice
+    {
+      auto first = db.prepare(select(tab.alpha).from(tab).where(tab.beta == parameter(tab.beta)));
+      auto second = db.prepare(select(tab.alpha).from(tab).where(tab.beta == parameter(tab.beta)));
+      require_equal(__LINE__, first == second, false);
+      require_equal(__LINE__, prepared_statements(), 2);
+    }
+    require_equal(__LINE__, prepared_statements(), 1);
+
+    // A released statement does not keep its last result
+    PQregisterEventProc(db.native_handle(), count_results, "count_results", nullptr);
+    {
+      auto prepared = db.prepare(select(tab.alpha).from(tab).where(tab.beta == parameter(tab.beta)));
+      prepared.params.beta = 1;
+      require_equal(__LINE__, db(prepared).front().alpha.value() % 10, 1);
+      require_equal(__LINE__, live_results, 1);
+    }
+    require_equal(__LINE__, live_results, 0);
+
+    // The least recently used statements are deallocated when the cache is full
+    db.prepare(select(tab.gamma).from(tab).where(tab.beta == parameter(tab.beta)));
+    db.prepare(remove_from(tab).where(tab.beta == parameter(tab.beta)));
+    require_equal(__LINE__, prepared_statements(), 2);
+
+    // Without the cache released statements are deallocated in batches
+    auto uncached = std::make_shared<sql::connection_config>(*config);
+    uncached->statement_cache_size = 0;
+    uncached->deallocate_batch_size = 3;
+    sql::connection other(uncached);
+    auto other_statements = [&other]() {
+      return other(select(sqlpp::verbatim<sqlpp::integral>("(SELECT count(*) FROM pg_prepared_statements)")
+                              .as(sqlpp::alias::a)))
+          .front()
+          .a.value();
+    };
+    other.prepare(select(tab.alpha).from(tab).where(tab.beta == parameter(tab.beta)));
+    other.prepare(select(tab.gamma).from(tab).where(tab.beta == parameter(tab.beta)));
+    require_equal(__LINE__, other_statements(), 2);
+    other.prepare(remove_from(tab).where(tab.beta == parameter(tab.beta)));
+    require_equal(__LINE__, other_statements(), 0);
+
+    // Not inside a transaction, where a failing DEALLOCATE would abort the transaction of the user
+    other.execute("BEGIN");
+    other.prepare(select(tab.alpha).from(tab).where(tab.beta == parameter(tab.beta)));
+    other.prepare(select(tab.gamma).from(tab).where(tab.beta == parameter(tab.beta)));
+    other.prepare(remove_from(tab).where(tab.beta == parameter(tab.beta)));
+    require_equal(__LINE__, other_statements(), 3);
+    other.execute("COMMIT");
+    require_equal(__LINE__, other_statements(), 0);
+
+    // Statements that are gone already do not keep the others from being deallocated
+    other.prepare(select(tab.alpha).from(tab).where(tab.beta == parameter(tab.beta)));
+    other.prepare(select(tab.gamma).from(tab).where(tab.beta == parameter(tab.beta)));
+    other.execute("DEALLOCATE ALL");
+    other.prepare(remove_from(tab).where(tab.beta == parameter(tab.beta)));
+    require_equal(__LINE__, other_statements(), 0);
+  }
+  catch (const sql::failure& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "TabFoo.h"
+#include <sqlpp11/postgresql/postgresql.h>
+#include <sqlpp11/sqlpp11.h>
+
+#include <iostream>
+
+namespace
+{
+  template <typename L, typename R>
+  void require_equal(int line, const L& l, const R& r)
+  {
+    if (l != r)
+    {
+      std::cerr << line << ": ";
+      serialize(::sqlpp::wrap_operand_t<L>{l}, std::cerr);
+      std::cerr << " != ";
+      serialize(::sqlpp::wrap_operand_t<R>{r}, std::cerr);
+      throw std::runtime_error("Unexpected result");
+    }
+  }
+}
+
+namespace sql = sqlpp::postgresql;
+int Stream(int, char*[])
+{
+  auto config = std::make_shared<sql::connection_config>();
+
+#ifdef WIN32
+  config->dbname = "test";
+  config->user = "test";
+  config->password = "test";
+  config->debug = true;
+#else
+  // TODO: assume there is a DB with the "username" as a name and the current user has "peer" access rights
+  config->dbname = getenv("USER");
+  config->user = config->dbname;
+  config->debug = false;
+#endif
+
+  try
+  {
+    sql::connection db(config);
+    db.execute(R"(DROP TABLE IF EXISTS tabfoo;)");
+    db.execute(R"(CREATE TABLE tabfoo
+                 (
+                   alpha bigserial NOT NULL,
+                   beta smallint,
+                   gamma text,
+                   c_bool boolean,
+                   c_timepoint timestamp with time zone,
+                   c_day date
+                 ))");
+    db.execute(R"(INSERT INTO tabfoo (beta, gamma) SELECT i % 100, 'row ' || i FROM generate_series(1, 1000) i)");
+
+    model::TabFoo tab = {};
+
+    // All rows, one at a time
+    auto rows = 0;
+    auto ordered = select(tab.alpha, tab.gamma).from(tab).unconditionally().order_by(tab.alpha.asc());
+    for (const auto& row : db.stream(ordered))
+    {
+      ++rows;
+      require_equal(__LINE__, row.alpha.value(), rows);
+      require_equal(__LINE__, row.gamma.value(), "row " + std::to_string(rows));
+    }
+    require_equal(__LINE__, rows, 1000);
+
+    // Leaving the loop early cancels the rest, the connection can be used right after
+    rows = 0;
+    for (const auto& row : db.stream(select(tab.alpha).from(tab).unconditionally(), 100))
+    {
+      if (++rows == 10)
+      {
+        break;
+      }
+      (void)row;
+    }
+    require_equal(__LINE__, rows, 10);
+    require_equal(__LINE__, db(select(count(tab.alpha)).from(tab).unconditionally()).front().count.value(), 1000);
+
+    // Prepared statements
+    auto prepared = db.prepare(select(tab.alpha).from(tab).where(tab.beta == parameter(tab.beta)));
+    prepared.params.beta = 42;
+    rows = 0;
+    for (const auto& row : db.stream_prepared(prepared))
+    {
+      ++rows;
+      require_equal(__LINE__, row.alpha.value() % 100, 42);
+    }
+    require_equal(__LINE__, rows, 10);
+
+    // Errors are reported while iterating
+    try
+    {
+      for (const auto& row : db.stream(select(tab.alpha).from(tab).where(tab.alpha / (tab.alpha - 500) > 0)))
+      {
+        (void)row;
+      }
+      throw std::runtime_error("Expected the division by zero to be reported");
+    }
+    catch (const sql::sql_error&)
+    {
+    }
+    require_equal(__LINE__, db(select(count(tab.alpha)).from(tab).unconditionally()).front().count.value(), 1000);
+  }
+  catch (const sql::failure& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
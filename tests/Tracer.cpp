@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026, Matthijs Möhlmann
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "TabFoo.h"
+#include <sqlpp11/postgresql/postgresql.h>
+#include <sqlpp11/sqlpp11.h>
+
+#include <iostream>
+#include <libpq-fe.h>
+
+namespace
+{
+  struct counting_tracer : public sqlpp::postgresql::tracer_t
+  {
+    int started = 0;
+    int ended = 0;
+    int failed = 0;
+    std::size_t rows = 0;
+    std::size_t bytes = 0;
+    std::string last_statement;
+
+    void statement_start(const std::string&) override
+    {
+      ++started;
+    }
+
+    void statement_end(const std::string& statement, const sqlpp::postgresql::statement_stats_t& stats) override
+    {
+      ++ended;
+      rows = stats.rows;
+      bytes = stats.bytes;
+      last_statement = statement;
+    }
+
+    void statement_error(const std::string&, const std::chrono::steady_clock::duration&, const std::string&) override
+    {
+      ++failed;
+    }
+  };
+
+  template <typename L, typename R>
+  void require_equal(int line, const L& l, const R& r)
+  {
+    if (l != r)
+    {
+      std::cerr << line << ": ";
+      serialize(::sqlpp::wrap_operand_t<L>{l}, std::cerr);
+      std::cerr << " != ";
+      serialize(::sqlpp::wrap_operand_t<R>{r}, std::cerr);
+      throw std::runtime_error("Unexpected result");
+    }
+  }
+}
+
+namespace sql = sqlpp::postgresql;
+int Tracer(int, char*[])
+{
+  auto config = std::make_shared<sql::connection_config>();
+
+#ifdef WIN32
+  config->dbname = "test";
+  config->user = "test";
+  config->password = "test";
+  config->debug = true;
+#else
+  // TODO: assume there is a DB with the "username" as a name and the current user has "peer" access rights
+  config->dbname = getenv("USER");
+  config->user = config->dbname;
+  config->debug = false;
+#endif
+
+  auto tracer = std::make_shared<counting_tracer>();
+  config->tracer = tracer;
+
+  try
+  {
+    sql::connection db(config);
+    db.execute(R"(DROP TABLE IF EXISTS tabfoo;)");
+    db.execute(R"(CREATE TABLE tabfoo
+                 (
+                   alpha bigserial NOT NULL,
+                   beta smallint,
+                   gamma text,
+                   c_bool boolean,
+                   c_timepoint timestamp with time zone,
+                   c_day date
+                 ))");
+    require_equal(__LINE__, tracer->started, 2);
+    require_equal(__LINE__, tracer->ended, 2);
+
+    model::TabFoo tab = {};
+    db(insert_into(tab).set(tab.beta = 1, tab.gamma = "abc"));
+    db(insert_into(tab).set(tab.beta = 2, tab.gamma = "de"));
+    require_equal(__LINE__, static_cast<int>(tracer->rows), 1);
+
+    // Rows and the memory of the result, at least the 5 bytes of the values (PQresultMemorySize came with libpq 12)
+    db(select(tab.gamma).from(tab).unconditionally());
+    require_equal(__LINE__, static_cast<int>(tracer->rows), 2);
+    require_equal(__LINE__, tracer->bytes > 5 || PQlibVersion() < 120000, true);
+
+    // Prepared statements report the text they were prepared with
+    auto prepared = db.prepare(update(tab).set(tab.c_bool = true).where(tab.beta == parameter(tab.beta)));
+    const auto started = tracer->started;
+    prepared.params.beta = 2;
+    db(prepared);
+    require_equal(__LINE__, tracer->started, started + 1);
+    require_equal(__LINE__, static_cast<int>(tracer->rows), 1);
+    require_equal(__LINE__, tracer->last_statement.find("UPDATE tabfoo") == 0, true);
+
+    // Streamed, asynchronous and pipelined statements and COPY end with their last result
+    auto streamed = 0;
+    for (const auto& row : db.stream(select(tab.alpha).from(tab).unconditionally()))
+    {
+      streamed += row.alpha.is_null() ? 0 : 1;
+    }
+    require_equal(__LINE__, streamed, 2);
+    require_equal(__LINE__, static_cast<int>(tracer->rows), 2);
+
+    require_equal(__LINE__, db.async_select(select(tab.gamma).from(tab).where(tab.beta == 1)).get().front().gamma.value(),
+                  "abc");
+    require_equal(__LINE__, static_cast<int>(tracer->rows), 1);
+
+    {
+      sql::pipeline_t pipeline(db);
+      auto updated = pipeline.execute(update(tab).set(tab.c_bool = false).unconditionally());
+      require_equal(__LINE__, static_cast<int>(updated.affected_rows()), 2);
+    }
+    require_equal(__LINE__, static_cast<int>(tracer->rows), 2);
+
+    auto copy = db.copy_in(tab, tab.beta, tab.gamma);
+    for (int i = 0; i < 3; ++i)
+    {
+      copy.push(i, "copied");
+    }
+    copy.finish();
+    require_equal(__LINE__, static_cast<int>(tracer->rows), 3);
+    auto copied = 0;
+    for (const auto& row : db.copy_out(select(tab.alpha).from(tab).unconditionally()))
+    {
+      copied += row.alpha.is_null() ? 0 : 1;
+    }
+    require_equal(__LINE__, copied, 5);
+    require_equal(__LINE__, static_cast<int>(tracer->rows), 5);
+    require_equal(__LINE__, tracer->started, tracer->ended);
+
+    // Errors are reported before they are thrown
+    try
+    {
+      db.execute("SELECT * FROM no_such_table");
+      throw std::runtime_error("Missing exception");
+    }
+    catch (const sql::failure&)
+    {
+    }
+    require_equal(__LINE__, tracer->failed, 1);
+    require_equal(__LINE__, tracer->started, tracer->ended + tracer->failed);
+  }
+  catch (const sql::failure& e)
+  {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}